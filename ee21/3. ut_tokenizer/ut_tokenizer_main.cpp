@@ -10,6 +10,11 @@ Tokenizer Unit Test for Expression Evaluator Project.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added hexadecimal, binary, and scientific notation literal tests.
+	Added variable slot tests.
+	Added exponent underflow test.
+
 Version 2021.11.01
 	C++ 20 validated
 
@@ -152,6 +157,20 @@ GATS_TEST_CASE(unknown_token) {
 		GATS_CHECK(test("23 42", TokenList({ make<Integer>(23), make<Integer>(42) })));
 	}
 
+	GATS_TEST_CASE(lexer_hex_integer) {
+		GATS_CHECK(test("0xFF", TokenList({ make<Integer>(255) })));
+		GATS_CHECK(test("0X1e5", TokenList({ make<Integer>(0x1e5) })));
+	}
+
+	GATS_TEST_CASE(lexer_hex_integer_big) {
+		GATS_CHECK(test("0x123456789abcdef0123456789ABCDEF", TokenList({ make<Integer>(Integer::value_type("0x123456789abcdef0123456789ABCDEF")) })));
+	}
+
+	GATS_TEST_CASE(lexer_binary_integer) {
+		GATS_CHECK(test("0b1010", TokenList({ make<Integer>(10) })));
+		GATS_CHECK(test("0B11111111111111111111111111111111111111111111111111111111111111111", TokenList({ make<Integer>(Integer::value_type("0x1FFFFFFFFFFFFFFFF")) })));
+	}
+
 
 	#if TEST_UNARY_OPERATOR
 		GATS_TEST_CASE(lexer_operator_identity) {
@@ -308,6 +327,35 @@ GATS_TEST_CASE(unknown_token) {
 			TokenList({ make<Real>(Real::value_type("1234567890123456789012345678901234567890.1234567890123456789012345678901234567890")) })));
 	}
 
+	GATS_TEST_CASE(lexer_real_whole_valued) {
+		GATS_CHECK(test("42.0", TokenList({ make<Real>(Real::value_type(42)) })));
+		GATS_CHECK(test("42.", TokenList({ make<Real>(Real::value_type(42)) })));
+	}
+
+	GATS_TEST_CASE(lexer_real_scientific) {
+		GATS_CHECK(test("1.5e-9", TokenList({ make<Real>(Real::value_type("1.5e-9")) })));
+		GATS_CHECK(test("1.5E+9", TokenList({ make<Real>(Real::value_type(1500000000)) })));
+		GATS_CHECK(test("2e3", TokenList({ make<Real>(Real::value_type(2000)) })));
+		GATS_CHECK(test("12345678901234567890e40", TokenList({ make<Real>(Real::value_type("12345678901234567890e40")) })));
+	}
+
+	GATS_TEST_CASE(lexer_real_exponent_overflow) {
+		try {
+			Tokenizer tkn;
+			TokenList tl = tkn.tokenize("1+1e99999999999");
+			GATS_FAIL("XNumericOverflow exception not thrown");
+		}
+		catch (Tokenizer::XNumericOverflow& e) {
+			GATS_CHECK(e.expression() == "1+1e99999999999");
+			GATS_CHECK(e.location() == 2);
+		}
+	}
+
+	GATS_TEST_CASE(lexer_real_exponent_underflow) {
+		GATS_CHECK(test("1e-999999999999", TokenList({ make<Real>(Real::value_type(0)) })));
+		GATS_CHECK(test("2.5e-99999999999+1", TokenList({ make<Real>(Real::value_type(0)), make<Addition>(), make<Integer>(1) })));
+	}
+
 
 	GATS_TEST_CASE(lexer_single_pi) { 
 		GATS_CHECK(test("pi", TokenList({ make<Pi>() }))); 
@@ -537,6 +585,21 @@ GATS_TEST_CASE(unknown_token) {
 		GATS_CHECK(p.get() == tl.front().get());
 	}
 
+	GATS_TEST_CASE(variable_slots) {
+		Tokenizer tkr;
+		TokenList tl = tkr.tokenize("b a b c");
+		GATS_CHECK(convert<Variable>(tl[0])->slot() == 0);
+		GATS_CHECK(convert<Variable>(tl[1])->slot() == 1);
+		GATS_CHECK(convert<Variable>(tl[2])->slot() == 0);
+		GATS_CHECK(convert<Variable>(tl[3])->slot() == 2);
+		GATS_CHECK(tkr.slot_of("a") == 1);
+		GATS_CHECK(tkr.slot_of("d") == 3);
+		GATS_CHECK(tkr.context()->size() == 4);
+
+		convert<Variable>(tl[1])->set(make_operand<Integer>(7));
+		GATS_CHECK(tkr.context()->value(1) == convert<Variable>(tl[1])->value());
+	}
+
 
 	#if TEST_BINARY_OPERATOR && TEST_INTEGER
 		GATS_TEST_CASE(lexer_single_operator_assignment) {
@@ -54,6 +54,7 @@ the program(s) have been supplied.
 
 // Parser system
 #include <ee/parser.hpp>
+#include <ee/boolean.hpp>
 #include <ee/function.hpp>
 #include <ee/integer.hpp>
 #include <ee/operator.hpp>
@@ -311,6 +312,49 @@ the program(s) have been supplied.
 	#endif // TEST_VARIABLE
 
 
+	#if TEST_INTEGER && TEST_BINARY_OPERATOR
+		GATS_TEST_CASE(parser_compile_stack_depth) {
+			// Test: 4+2*3 needs three stack slots
+			Program program = Parser().compile(TokenList({ make<Integer>(4), make<Addition>(), make<Integer>(2), make<Multiplication>(), make<Integer>(3) }));
+			GATS_CHECK(program.stack_depth() == 3);
+			GATS_CHECK(program.tokens().size() == 5);
+		}
+
+		GATS_TEST_CASE(parser_compile_malformed) {
+			GATS_CHECK_THROW((void)Parser().compile(TokenList()), std::exception&);
+			GATS_CHECK_THROW(Program(TokenList({ make<Integer>(4), make<Addition>() })), std::exception&);
+			GATS_CHECK_THROW(Program(TokenList({ make<Integer>(4), make<Integer>(2) })), std::exception&);
+		}
+	#endif // TEST_INTEGER && TEST_BINARY_OPERATOR
+
+
+	#if TEST_CONDITIONAL
+		/*! Make a jump token with its target already resolved. */
+		template <typename JUMP_TYPE>
+		[[nodiscard]] Token::pointer_type make_jump(std::size_t target) {
+			auto jump = make<JUMP_TYPE>();
+			convert<Jump>(jump)->set_target(target);
+			return jump;
+		}
+
+		GATS_TEST_CASE(parser_conditional) {
+			GATS_CHECK(parse_test(
+				// Test: if(true,1,2)
+				TokenList({ make<If>(), make<LeftParenthesis>(), make<True>(), make<ArgumentSeparator>(), make<Integer>(1), make<ArgumentSeparator>(), make<Integer>(2), make<RightParenthesis>() }),
+				TokenList({ make<True>(), make_jump<JumpIfFalse>(4), make<Integer>(1), make_jump<Jump>(5), make<Integer>(2) })
+				));
+		}
+
+		GATS_TEST_CASE(parser_conditional_in_expression) {
+			GATS_CHECK(parse_test(
+				// Test: 3*if(false,1+2,4)
+				TokenList({ make<Integer>(3), make<Multiplication>(), make<If>(), make<LeftParenthesis>(), make<False>(), make<ArgumentSeparator>(), make<Integer>(1), make<Addition>(), make<Integer>(2), make<ArgumentSeparator>(), make<Integer>(4), make<RightParenthesis>() }),
+				TokenList({ make<Integer>(3), make<False>(), make_jump<JumpIfFalse>(7), make<Integer>(1), make<Integer>(2), make<Addition>(), make_jump<Jump>(8), make<Integer>(4), make<Multiplication>() })
+				));
+		}
+	#endif // TEST_CONDITIONAL
+
+
 
 #endif // TEST_PARSER
 
@@ -32,6 +32,8 @@
 #define TEST_VARIABLE false
 #define TEST_RESULT false
 
+#define TEST_CONDITIONAL true
+
 #define TEST_PARSER true
 
 #define TEST_GREGORIAN false
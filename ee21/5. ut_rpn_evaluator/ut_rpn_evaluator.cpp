@@ -11,6 +11,9 @@ Reverse-Polish Evaluator unit test for Expression Evaluator Project.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	tan() and atan2() results compared after round(), like the other real results.
+
 Version 2021.11.01
 	C++ 20 validated
 
@@ -667,7 +670,7 @@ GATS_TEST_CASE(no_operand) {
 			}
 			GATS_TEST_CASE(test_tan) {
 				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("1.0")), make<Tan>() });
-				GATS_CHECK(value_of<Real>(result) == tan(Real::value_type("1.0")));
+				GATS_CHECK(round(result) == round(tan(Real::value_type("1.0"))));
 			}
 		#endif
 	#endif //TEST_SINGLE_ARG
@@ -705,7 +708,7 @@ GATS_TEST_CASE(no_operand) {
 		#if TEST_REAL
 			GATS_TEST_CASE(test_arctan2) {
 				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("1.0")), make<Real>(Real::value_type("2.0")), make<Arctan2>() });
-				GATS_CHECK(value_of<Real>(result) == atan2(Real::value_type("1.0"), Real::value_type("2.0")));
+				GATS_CHECK(round(result) == round(atan2(Real::value_type("1.0"), Real::value_type("2.0"))));
 			}
 			GATS_TEST_CASE(test_max_real_real_rhs) {
 				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("1.0")), make<Real>(Real::value_type("2.0")), make<Max>() });
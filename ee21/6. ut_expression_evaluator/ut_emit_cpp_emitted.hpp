@@ -0,0 +1,1173 @@
+#pragma once
+// Generated from ut_emit_cpp_corpus.txt by: ee --emit-cpp --no-fold ut_emit_cpp_corpus.txt
+
+// Helpers of the functions written by emit_cpp().
+#ifndef EE_GENERATED_MULTIPRECISION
+#define EE_GENERATED_MULTIPRECISION
+#include <ee/transcendental.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ee_mp {
+	using integer = boost::multiprecision::cpp_int;
+	using real = boost::multiprecision::number<boost::multiprecision::cpp_dec_float<1000, std::int32_t, void>>;
+
+	[[nodiscard]] inline real real_abs(real const& x) { return real(boost::multiprecision::abs(x)); }
+	[[nodiscard]] inline real real_acos(real const& x) { return transcendental::acos(x); }
+	[[nodiscard]] inline real real_asin(real const& x) { return transcendental::asin(x); }
+	[[nodiscard]] inline real real_atan(real const& x) { return transcendental::atan(x); }
+	[[nodiscard]] inline real real_atan2(real const& y, real const& x) { return transcendental::atan2(y, x); }
+	[[nodiscard]] inline real real_ceil(real const& x) { return real(boost::multiprecision::ceil(x)); }
+	[[nodiscard]] inline real real_cos(real const& x) { return transcendental::cos(x); }
+	[[nodiscard]] inline real real_exp(real const& x) { return real(boost::multiprecision::exp(x)); }
+	[[nodiscard]] inline real real_floor(real const& x) { return real(boost::multiprecision::floor(x)); }
+	[[nodiscard]] inline real real_fmod(real const& l, real const& r) { return real(boost::multiprecision::fmod(l, r)); }
+	[[nodiscard]] inline real real_lb(real const& x) { return transcendental::log2(x); }
+	[[nodiscard]] inline real real_ln(real const& x) { return transcendental::log(x); }
+	[[nodiscard]] inline real real_log(real const& x) { return transcendental::log10(x); }
+	[[nodiscard]] inline real real_pow(real const& x, real const& y) { return transcendental::pow(x, y); }
+	[[nodiscard]] inline real real_sin(real const& x) { return transcendental::sin(x); }
+	[[nodiscard]] inline real real_sqrt(real const& x) { return real(boost::multiprecision::sqrt(x)); }
+	[[nodiscard]] inline real real_tan(real const& x) { return transcendental::tan(x); }
+
+	// Factorial::max_argument and Power::max_result_bits when the code was written
+	inline constexpr std::uint64_t max_factorial_argument = 100000;
+	inline constexpr std::uint64_t max_power_result_bits = 1000000;
+
+	[[nodiscard]] inline integer integer_add(integer const& l, integer const& r) { return integer(l + r); }
+	[[nodiscard]] inline integer integer_subtract(integer const& l, integer const& r) { return integer(l - r); }
+	[[nodiscard]] inline integer integer_multiply(integer const& l, integer const& r) { return integer(l * r); }
+	[[nodiscard]] inline integer integer_divide(integer const& l, integer const& r) { return integer(l / r); }
+	[[nodiscard]] inline integer integer_modulus(integer const& l, integer const& r) { return integer(l % r); }
+	[[nodiscard]] inline integer integer_negate(integer const& x) { return integer(-x); }
+	[[nodiscard]] inline integer integer_abs(integer const& x) { return integer(boost::multiprecision::abs(x)); }
+
+	[[nodiscard]] inline real real_power(real const& base, integer const& exponent) {
+		if (boost::multiprecision::abs(exponent) <= std::numeric_limits<long long>::max())
+			return real(boost::multiprecision::pow(base, exponent.convert_to<long long>()));
+		return transcendental::pow(base, real(exponent));
+	}
+
+	[[nodiscard]] inline integer integer_power(integer const& base, integer const& exponent) {
+		if (base == 0)
+			return exponent == 0 ? 1 : 0;
+		if (base == 1)
+			return 1;
+		if (base == -1)
+			return boost::multiprecision::bit_test(exponent, 0) ? -1 : 1;
+		integer const magnitude = boost::multiprecision::abs(base);
+		auto const shift = boost::multiprecision::lsb(magnitude);
+		bool const powerOfTwo = magnitude == integer(1) << shift;
+		auto const bitsPerFactor = powerOfTwo ? shift : boost::multiprecision::msb(magnitude) + 1;
+		if (exponent > max_power_result_bits / bitsPerFactor || exponent > std::numeric_limits<unsigned>::max())
+			throw std::runtime_error("Error: power result too large");
+		auto const e = exponent.convert_to<unsigned>();
+		if (powerOfTwo) {
+			integer const result = integer(1) << (std::uint64_t(shift) * e);
+			return base < 0 && e % 2 ? integer(-result) : result;
+		}
+		return integer(boost::multiprecision::pow(base, e));
+	}
+
+	[[nodiscard]] inline integer integer_factorial(integer const& n) {
+		if (n < 0)
+			throw std::runtime_error("Error: factorial of a negative number");
+		if (n > max_factorial_argument)
+			throw std::runtime_error("Error: factorial argument too large");
+		integer result = 1;
+		for (unsigned i = 2; i <= n; ++i)
+			result *= i;
+		return result;
+	}
+
+	template <typename T> inline constexpr bool is_integer_v = std::is_same_v<T, integer>;
+	template <typename T> inline constexpr bool is_real_v = std::is_same_v<T, real>;
+	template <typename T> inline constexpr bool is_number_v = is_integer_v<T> || is_real_v<T>;
+	template <typename T> inline constexpr bool is_boolean_v = std::is_same_v<T, bool>;
+
+	/*! Integer when both operands are Integers, otherwise Real. */
+	template <typename L, typename R>
+	using promoted_t = std::conditional_t<is_integer_v<L> && is_integer_v<R>, integer, real>;
+
+	template <typename T>
+	[[nodiscard]] real to_real(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand is not a number");
+		return real(x);
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> add(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return integer_add(l, r);
+		else
+			return T(T(l) + T(r));
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> subtract(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return integer_subtract(l, r);
+		else
+			return T(T(l) - T(r));
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> multiply(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return integer_multiply(l, r);
+		else
+			return T(T(l) * T(r));
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> divide(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>) {
+			if (r == 0)
+				throw std::runtime_error("Error: division by zero");
+			return integer_divide(l, r);
+		}
+		else
+			return T(T(l) / T(r));
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> modulus(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>) {
+			if (r == 0)
+				throw std::runtime_error("Error: division by zero");
+			return integer_modulus(l, r);
+		}
+		else
+			return real_fmod(T(l), T(r));
+	}
+
+	/*! An Integer raised to a negative Integer power would be a Real, so it throws. */
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> power(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		if constexpr (is_integer_v<L> && is_integer_v<R>) {
+			if (r < 0)
+				throw std::runtime_error("Error: negative exponent of an integer");
+			return integer_power(l, r);
+		}
+		else if constexpr (is_integer_v<R>)
+			return real_power(l, r);
+		else
+			return real_pow(to_real(l), to_real(r));
+	}
+
+	template <typename T>
+	[[nodiscard]] T identity(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand must be a number");
+		return x;
+	}
+
+	template <typename T>
+	[[nodiscard]] T negate(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand must be a number");
+		if constexpr (is_integer_v<T>)
+			return integer_negate(x);
+		else
+			return T(-x);
+	}
+
+	template <typename T>
+	[[nodiscard]] integer factorial(T const& n) {
+		static_assert(is_integer_v<T>, "Error: factorial requires an integer");
+		return integer_factorial(n);
+	}
+
+	template <typename T>
+	[[nodiscard]] bool logical_not(T const& x) {
+		static_assert(is_boolean_v<T>, "Error: operand must be a boolean");
+		return !x;
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_and(L const& l, R const& r) {
+		static_assert(is_boolean_v<L> && is_boolean_v<R>, "Error: operands must be booleans");
+		return l && r;
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_or(L const& l, R const& r) {
+		static_assert(is_boolean_v<L> && is_boolean_v<R>, "Error: operands must be booleans");
+		return l || r;
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_xor(L const& l, R const& r) {
+		static_assert(is_boolean_v<L> && is_boolean_v<R>, "Error: operands must be booleans");
+		return l != r;
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_nand(L const& l, R const& r) { return !logical_and(l, r); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_nor(L const& l, R const& r) { return !logical_or(l, r); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_xnor(L const& l, R const& r) { return !logical_xor(l, r); }
+
+	/*! Numeric comparison, or boolean comparison (false < true) of two booleans. */
+	template <typename L, typename R, typename COMPARE>
+	[[nodiscard]] bool compare(L const& l, R const& r, COMPARE compare) {
+		if constexpr (is_boolean_v<L> && is_boolean_v<R>)
+			return compare(l, r);
+		else {
+			static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+			using T = promoted_t<L, R>;
+			return compare(T(l), T(r));
+		}
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool equal(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a == b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool not_equal(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a != b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool less(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a < b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool less_equal(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a <= b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool greater(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a > b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool greater_equal(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a >= b; }); }
+
+	template <typename T>
+	[[nodiscard]] T abs(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand is not a number");
+		if constexpr (is_integer_v<T>)
+			return integer_abs(x);
+		else
+			return real_abs(x);
+	}
+
+	template <typename T>
+	[[nodiscard]] T ceil(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand is not a number");
+		if constexpr (is_integer_v<T>)
+			return x;
+		else
+			return real_ceil(x);
+	}
+
+	template <typename T>
+	[[nodiscard]] T floor(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand is not a number");
+		if constexpr (is_integer_v<T>)
+			return x;
+		else
+			return real_floor(x);
+	}
+
+	template <typename T> [[nodiscard]] real arccos(T const& x) { return real_acos(to_real(x)); }
+	template <typename T> [[nodiscard]] real arcsin(T const& x) { return real_asin(to_real(x)); }
+	template <typename T> [[nodiscard]] real arctan(T const& x) { return real_atan(to_real(x)); }
+	template <typename T> [[nodiscard]] real cos(T const& x) { return real_cos(to_real(x)); }
+	template <typename T> [[nodiscard]] real exp(T const& x) { return real_exp(to_real(x)); }
+	template <typename T> [[nodiscard]] real lb(T const& x) { return real_lb(to_real(x)); }
+	template <typename T> [[nodiscard]] real ln(T const& x) { return real_ln(to_real(x)); }
+	template <typename T> [[nodiscard]] real log(T const& x) { return real_log(to_real(x)); }
+	template <typename T> [[nodiscard]] real sin(T const& x) { return real_sin(to_real(x)); }
+	template <typename T> [[nodiscard]] real sqrt(T const& x) { return real_sqrt(to_real(x)); }
+	template <typename T> [[nodiscard]] real tan(T const& x) { return real_tan(to_real(x)); }
+
+	template <typename Y, typename X>
+	[[nodiscard]] real arctan2(Y const& y, X const& x) { return real_atan2(to_real(y), to_real(x)); }
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> maximum(L const& l, R const& r) {
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return l >= r ? l : r;
+		else {
+			auto const a = to_real(l), b = to_real(r);
+			return a >= b ? a : b;
+		}
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> minimum(L const& l, R const& r) {
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return l <= r ? l : r;
+		else {
+			auto const a = to_real(l), b = to_real(r);
+			return a <= b ? a : b;
+		}
+	}
+
+	/*! if(): evaluates one branch; numeric branches of different types are converted to Real. */
+	template <typename C, typename THEN, typename ELSE>
+	[[nodiscard]] auto conditional(C const& condition, THEN const& then, ELSE const& otherwise) {
+		static_assert(is_boolean_v<C>, "Error: condition must be a boolean");
+		using A = decltype(then());
+		using B = decltype(otherwise());
+		static_assert(std::is_same_v<A, B> || (is_number_v<A> && is_number_v<B>), "Error: the branches of if() have different types");
+		using T = std::conditional_t<std::is_same_v<A, B>, A, promoted_t<A, B>>;
+		return condition ? T(then()) : T(otherwise());
+	}
+}
+#endif
+
+// m001: 1000
+[[nodiscard]] inline auto m001() {
+	return ee_mp::integer(1000);
+}
+
+// m002: 42
+[[nodiscard]] inline auto m002() {
+	return ee_mp::integer(42);
+}
+
+// m003: 0
+[[nodiscard]] inline auto m003() {
+	return ee_mp::integer(0);
+}
+
+// m004: -42
+[[nodiscard]] inline auto m004() {
+	return ee_mp::negate(ee_mp::integer(42));
+}
+
+// m005: 123456789012345678901234567890123456789012345678901234567890
+[[nodiscard]] inline auto m005() {
+	static ee_mp::integer const literal0("123456789012345678901234567890123456789012345678901234567890");
+	return literal0;
+}
+
+// m006: +42
+[[nodiscard]] inline auto m006() {
+	return ee_mp::identity(ee_mp::integer(42));
+}
+
+// m007: 5!
+[[nodiscard]] inline auto m007() {
+	return ee_mp::factorial(ee_mp::integer(5));
+}
+
+// m008: 100!
+[[nodiscard]] inline auto m008() {
+	return ee_mp::factorial(ee_mp::integer(100));
+}
+
+// m009: 2+3
+[[nodiscard]] inline auto m009() {
+	return ee_mp::add(ee_mp::integer(2), ee_mp::integer(3));
+}
+
+// m010: 2-3
+[[nodiscard]] inline auto m010() {
+	return ee_mp::subtract(ee_mp::integer(2), ee_mp::integer(3));
+}
+
+// m011: 2*3
+[[nodiscard]] inline auto m011() {
+	return ee_mp::multiply(ee_mp::integer(2), ee_mp::integer(3));
+}
+
+// m012: 21/3
+[[nodiscard]] inline auto m012() {
+	return ee_mp::divide(ee_mp::integer(21), ee_mp::integer(3));
+}
+
+// m013: 23/3
+[[nodiscard]] inline auto m013() {
+	return ee_mp::divide(ee_mp::integer(23), ee_mp::integer(3));
+}
+
+// m014: 21%3
+[[nodiscard]] inline auto m014() {
+	return ee_mp::modulus(ee_mp::integer(21), ee_mp::integer(3));
+}
+
+// m015: 23%3
+[[nodiscard]] inline auto m015() {
+	return ee_mp::modulus(ee_mp::integer(23), ee_mp::integer(3));
+}
+
+// m016: 5**2
+[[nodiscard]] inline auto m016() {
+	return ee_mp::power(ee_mp::integer(5), ee_mp::integer(2));
+}
+
+// m017: 123**123
+[[nodiscard]] inline auto m017() {
+	return ee_mp::power(ee_mp::integer(123), ee_mp::integer(123));
+}
+
+// m018: -7**2
+[[nodiscard]] inline auto m018() {
+	return ee_mp::negate(ee_mp::power(ee_mp::integer(7), ee_mp::integer(2)));
+}
+
+// m019: 2*3+4
+[[nodiscard]] inline auto m019() {
+	return ee_mp::add(ee_mp::multiply(ee_mp::integer(2), ee_mp::integer(3)), ee_mp::integer(4));
+}
+
+// m020: 21/3-5
+[[nodiscard]] inline auto m020() {
+	return ee_mp::subtract(ee_mp::divide(ee_mp::integer(21), ee_mp::integer(3)), ee_mp::integer(5));
+}
+
+// m021: 2+3*4
+[[nodiscard]] inline auto m021() {
+	return ee_mp::add(ee_mp::integer(2), ee_mp::multiply(ee_mp::integer(3), ee_mp::integer(4)));
+}
+
+// m022: 2-32/4
+[[nodiscard]] inline auto m022() {
+	return ee_mp::subtract(ee_mp::integer(2), ee_mp::divide(ee_mp::integer(32), ee_mp::integer(4)));
+}
+
+// m023: 4!!
+[[nodiscard]] inline auto m023() {
+	return ee_mp::factorial(ee_mp::factorial(ee_mp::integer(4)));
+}
+
+// m024: 2*4!-4
+[[nodiscard]] inline auto m024() {
+	return ee_mp::subtract(ee_mp::multiply(ee_mp::integer(2), ee_mp::factorial(ee_mp::integer(4))), ee_mp::integer(4));
+}
+
+// m025: 20*3-32/4
+[[nodiscard]] inline auto m025() {
+	return ee_mp::subtract(ee_mp::multiply(ee_mp::integer(20), ee_mp::integer(3)), ee_mp::divide(ee_mp::integer(32), ee_mp::integer(4)));
+}
+
+// m026: (21+5)/(7+6)
+[[nodiscard]] inline auto m026() {
+	return ee_mp::divide(ee_mp::add(ee_mp::integer(21), ee_mp::integer(5)), ee_mp::add(ee_mp::integer(7), ee_mp::integer(6)));
+}
+
+// m027: (5+6*7)*(4+3)/(1+(5+6*7))
+[[nodiscard]] inline auto m027() {
+	return ee_mp::divide(ee_mp::multiply(ee_mp::add(ee_mp::integer(5), ee_mp::multiply(ee_mp::integer(6), ee_mp::integer(7))), ee_mp::add(ee_mp::integer(4), ee_mp::integer(3))), ee_mp::add(ee_mp::integer(1), ee_mp::add(ee_mp::integer(5), ee_mp::multiply(ee_mp::integer(6), ee_mp::integer(7)))));
+}
+
+// m028: (4 + 2 * 5) / (1 + 3 * 2)
+[[nodiscard]] inline auto m028() {
+	return ee_mp::divide(ee_mp::add(ee_mp::integer(4), ee_mp::multiply(ee_mp::integer(2), ee_mp::integer(5))), ee_mp::add(ee_mp::integer(1), ee_mp::multiply(ee_mp::integer(3), ee_mp::integer(2))));
+}
+
+// m029: 23 mod 3
+[[nodiscard]] inline auto m029() {
+	return ee_mp::modulus(ee_mp::integer(23), ee_mp::integer(3));
+}
+
+// m030: 15 mod 6 * 3
+[[nodiscard]] inline auto m030() {
+	return ee_mp::multiply(ee_mp::modulus(ee_mp::integer(15), ee_mp::integer(6)), ee_mp::integer(3));
+}
+
+// m031: 4**3**2
+[[nodiscard]] inline auto m031() {
+	return ee_mp::power(ee_mp::integer(4), ee_mp::power(ee_mp::integer(3), ee_mp::integer(2)));
+}
+
+// m032: (2)
+[[nodiscard]] inline auto m032() {
+	return ee_mp::integer(2);
+}
+
+// m033: ((2))
+[[nodiscard]] inline auto m033() {
+	return ee_mp::integer(2);
+}
+
+// m034: (3+4)*5
+[[nodiscard]] inline auto m034() {
+	return ee_mp::multiply(ee_mp::add(ee_mp::integer(3), ee_mp::integer(4)), ee_mp::integer(5));
+}
+
+// m035: ((1+2)*3)-4*(2-3)
+[[nodiscard]] inline auto m035() {
+	return ee_mp::subtract(ee_mp::multiply(ee_mp::add(ee_mp::integer(1), ee_mp::integer(2)), ee_mp::integer(3)), ee_mp::multiply(ee_mp::integer(4), ee_mp::subtract(ee_mp::integer(2), ee_mp::integer(3))));
+}
+
+// m036: (2**3)**4
+[[nodiscard]] inline auto m036() {
+	return ee_mp::power(ee_mp::power(ee_mp::integer(2), ee_mp::integer(3)), ee_mp::integer(4));
+}
+
+// m037: abs(4)
+[[nodiscard]] inline auto m037() {
+	return ee_mp::abs(ee_mp::integer(4));
+}
+
+// m038: abs(-4)
+[[nodiscard]] inline auto m038() {
+	return ee_mp::abs(ee_mp::negate(ee_mp::integer(4)));
+}
+
+// m039: 1234.5678
+[[nodiscard]] inline auto m039() {
+	static ee_mp::real const literal0("1234.5678");
+	return literal0;
+}
+
+// m040: 123456789012345678901234567890123456789012345678901234567890.123456789012345678901234567890123456789012345678901234567890
+[[nodiscard]] inline auto m040() {
+	static ee_mp::real const literal0("123456789012345678901234567890123456789012345678901234567890.12345678901234567890123456789012345678901234567890123456789");
+	return literal0;
+}
+
+// m041: e
+[[nodiscard]] inline auto m041() {
+	static ee_mp::real const literal0 = boost::math::constants::e<ee_mp::real>();
+	return literal0;
+}
+
+// m042: E
+[[nodiscard]] inline auto m042() {
+	static ee_mp::real const literal0 = boost::math::constants::e<ee_mp::real>();
+	return literal0;
+}
+
+// m043: pi
+[[nodiscard]] inline auto m043() {
+	static ee_mp::real const literal0 = boost::math::constants::pi<ee_mp::real>();
+	return literal0;
+}
+
+// m044: Pi
+[[nodiscard]] inline auto m044() {
+	static ee_mp::real const literal0 = boost::math::constants::pi<ee_mp::real>();
+	return literal0;
+}
+
+// m045: PI
+[[nodiscard]] inline auto m045() {
+	static ee_mp::real const literal0 = boost::math::constants::pi<ee_mp::real>();
+	return literal0;
+}
+
+// m046: +42.3
+[[nodiscard]] inline auto m046() {
+	static ee_mp::real const literal0("42.3");
+	return ee_mp::identity(literal0);
+}
+
+// m047: -42.3
+[[nodiscard]] inline auto m047() {
+	static ee_mp::real const literal0("42.3");
+	return ee_mp::negate(literal0);
+}
+
+// m048: 2.2+3.3
+[[nodiscard]] inline auto m048() {
+	static ee_mp::real const literal0("2.2");
+	static ee_mp::real const literal1("3.3");
+	return ee_mp::add(literal0, literal1);
+}
+
+// m049: 2.2-3.3
+[[nodiscard]] inline auto m049() {
+	static ee_mp::real const literal0("2.2");
+	static ee_mp::real const literal1("3.3");
+	return ee_mp::subtract(literal0, literal1);
+}
+
+// m050: 2.5*3.5
+[[nodiscard]] inline auto m050() {
+	static ee_mp::real const literal0("2.5");
+	static ee_mp::real const literal1("3.5");
+	return ee_mp::multiply(literal0, literal1);
+}
+
+// m051: 5.5/1.1
+[[nodiscard]] inline auto m051() {
+	static ee_mp::real const literal0("5.5");
+	static ee_mp::real const literal1("1.1");
+	return ee_mp::divide(literal0, literal1);
+}
+
+// m052: 4.0 ** 0.5
+[[nodiscard]] inline auto m052() {
+	static ee_mp::real const literal0("4.0");
+	static ee_mp::real const literal1("0.5");
+	return ee_mp::power(literal0, literal1);
+}
+
+// m053: cos(0.0)
+[[nodiscard]] inline auto m053() {
+	static ee_mp::real const literal0("0.0");
+	return ee_mp::cos(literal0);
+}
+
+// m054: arccos(1.0)
+[[nodiscard]] inline auto m054() {
+	static ee_mp::real const literal0("1.0");
+	return ee_mp::arccos(literal0);
+}
+
+// m055: sin(0.0)
+[[nodiscard]] inline auto m055() {
+	static ee_mp::real const literal0("0.0");
+	return ee_mp::sin(literal0);
+}
+
+// m056: arcsin(1.0)
+[[nodiscard]] inline auto m056() {
+	static ee_mp::real const literal0("1.0");
+	return ee_mp::arcsin(literal0);
+}
+
+// m057: tan(0.0)
+[[nodiscard]] inline auto m057() {
+	static ee_mp::real const literal0("0.0");
+	return ee_mp::tan(literal0);
+}
+
+// m058: arctan(0.0)
+[[nodiscard]] inline auto m058() {
+	static ee_mp::real const literal0("0.0");
+	return ee_mp::arctan(literal0);
+}
+
+// m059: abs(4.0)
+[[nodiscard]] inline auto m059() {
+	static ee_mp::real const literal0("4.0");
+	return ee_mp::abs(literal0);
+}
+
+// m060: abs(-4.0)
+[[nodiscard]] inline auto m060() {
+	static ee_mp::real const literal0("4.0");
+	return ee_mp::abs(ee_mp::negate(literal0));
+}
+
+// m061: ceil(4.3)
+[[nodiscard]] inline auto m061() {
+	static ee_mp::real const literal0("4.3");
+	return ee_mp::ceil(literal0);
+}
+
+// m062: ceil(-4.3)
+[[nodiscard]] inline auto m062() {
+	static ee_mp::real const literal0("4.3");
+	return ee_mp::ceil(ee_mp::negate(literal0));
+}
+
+// m063: exp(1.0)
+[[nodiscard]] inline auto m063() {
+	static ee_mp::real const literal0("1.0");
+	return ee_mp::exp(literal0);
+}
+
+// m064: floor(4.3)
+[[nodiscard]] inline auto m064() {
+	static ee_mp::real const literal0("4.3");
+	return ee_mp::floor(literal0);
+}
+
+// m065: floor(-4.3)
+[[nodiscard]] inline auto m065() {
+	static ee_mp::real const literal0("4.3");
+	return ee_mp::floor(ee_mp::negate(literal0));
+}
+
+// m066: lb(8.0)
+[[nodiscard]] inline auto m066() {
+	static ee_mp::real const literal0("8.0");
+	return ee_mp::lb(literal0);
+}
+
+// m067: ln(1.0)
+[[nodiscard]] inline auto m067() {
+	static ee_mp::real const literal0("1.0");
+	return ee_mp::ln(literal0);
+}
+
+// m068: sqrt(16.0)
+[[nodiscard]] inline auto m068() {
+	static ee_mp::real const literal0("16.0");
+	return ee_mp::sqrt(literal0);
+}
+
+// m069: 1.0/(1.0/32.0+1.0/48.0)
+[[nodiscard]] inline auto m069() {
+	static ee_mp::real const literal0("1.0");
+	static ee_mp::real const literal1("1.0");
+	static ee_mp::real const literal2("32.0");
+	static ee_mp::real const literal3("1.0");
+	static ee_mp::real const literal4("48.0");
+	return ee_mp::divide(literal0, ee_mp::add(ee_mp::divide(literal1, literal2), ee_mp::divide(literal3, literal4)));
+}
+
+// m070: sin(1.0)**2+cos(1.0)**2
+[[nodiscard]] inline auto m070() {
+	static ee_mp::real const literal0("1.0");
+	static ee_mp::real const literal1("1.0");
+	return ee_mp::add(ee_mp::power(ee_mp::sin(literal0), ee_mp::integer(2)), ee_mp::power(ee_mp::cos(literal1), ee_mp::integer(2)));
+}
+
+// m071: 1+3.3
+[[nodiscard]] inline auto m071() {
+	static ee_mp::real const literal0("3.3");
+	return ee_mp::add(ee_mp::integer(1), literal0);
+}
+
+// m072: 5/2.0
+[[nodiscard]] inline auto m072() {
+	static ee_mp::real const literal0("2.0");
+	return ee_mp::divide(ee_mp::integer(5), literal0);
+}
+
+// m073: 5.0/2
+[[nodiscard]] inline auto m073() {
+	static ee_mp::real const literal0("5.0");
+	return ee_mp::divide(literal0, ee_mp::integer(2));
+}
+
+// m074: true
+[[nodiscard]] inline auto m074() {
+	return true;
+}
+
+// m075: True
+[[nodiscard]] inline auto m075() {
+	return true;
+}
+
+// m076: TRUE
+[[nodiscard]] inline auto m076() {
+	return true;
+}
+
+// m077: false
+[[nodiscard]] inline auto m077() {
+	return false;
+}
+
+// m078: False
+[[nodiscard]] inline auto m078() {
+	return false;
+}
+
+// m079: FALSE
+[[nodiscard]] inline auto m079() {
+	return false;
+}
+
+// m080: true and true
+[[nodiscard]] inline auto m080() {
+	return ee_mp::logical_and(true, true);
+}
+
+// m081: true and false
+[[nodiscard]] inline auto m081() {
+	return ee_mp::logical_and(true, false);
+}
+
+// m082: false and true
+[[nodiscard]] inline auto m082() {
+	return ee_mp::logical_and(false, true);
+}
+
+// m083: false and false
+[[nodiscard]] inline auto m083() {
+	return ee_mp::logical_and(false, false);
+}
+
+// m084: true or true
+[[nodiscard]] inline auto m084() {
+	return ee_mp::logical_or(true, true);
+}
+
+// m085: true or false
+[[nodiscard]] inline auto m085() {
+	return ee_mp::logical_or(true, false);
+}
+
+// m086: false or true
+[[nodiscard]] inline auto m086() {
+	return ee_mp::logical_or(false, true);
+}
+
+// m087: false or false
+[[nodiscard]] inline auto m087() {
+	return ee_mp::logical_or(false, false);
+}
+
+// m088: true xor true
+[[nodiscard]] inline auto m088() {
+	return ee_mp::logical_xor(true, true);
+}
+
+// m089: true xor false
+[[nodiscard]] inline auto m089() {
+	return ee_mp::logical_xor(true, false);
+}
+
+// m090: false xor true
+[[nodiscard]] inline auto m090() {
+	return ee_mp::logical_xor(false, true);
+}
+
+// m091: false xor false
+[[nodiscard]] inline auto m091() {
+	return ee_mp::logical_xor(false, false);
+}
+
+// m092: true nand true
+[[nodiscard]] inline auto m092() {
+	return ee_mp::logical_nand(true, true);
+}
+
+// m093: true nand false
+[[nodiscard]] inline auto m093() {
+	return ee_mp::logical_nand(true, false);
+}
+
+// m094: false nand true
+[[nodiscard]] inline auto m094() {
+	return ee_mp::logical_nand(false, true);
+}
+
+// m095: false nand false
+[[nodiscard]] inline auto m095() {
+	return ee_mp::logical_nand(false, false);
+}
+
+// m096: true nor true
+[[nodiscard]] inline auto m096() {
+	return ee_mp::logical_nor(true, true);
+}
+
+// m097: true nor false
+[[nodiscard]] inline auto m097() {
+	return ee_mp::logical_nor(true, false);
+}
+
+// m098: false nor true
+[[nodiscard]] inline auto m098() {
+	return ee_mp::logical_nor(false, true);
+}
+
+// m099: false nor false
+[[nodiscard]] inline auto m099() {
+	return ee_mp::logical_nor(false, false);
+}
+
+// m100: true xnor true
+[[nodiscard]] inline auto m100() {
+	return ee_mp::logical_xnor(true, true);
+}
+
+// m101: true xnor false
+[[nodiscard]] inline auto m101() {
+	return ee_mp::logical_xnor(true, false);
+}
+
+// m102: false xnor true
+[[nodiscard]] inline auto m102() {
+	return ee_mp::logical_xnor(false, true);
+}
+
+// m103: false xnor false
+[[nodiscard]] inline auto m103() {
+	return ee_mp::logical_xnor(false, false);
+}
+
+// m104: true == true
+[[nodiscard]] inline auto m104() {
+	return ee_mp::equal(true, true);
+}
+
+// m105: false == true
+[[nodiscard]] inline auto m105() {
+	return ee_mp::equal(false, true);
+}
+
+// m106: true != true
+[[nodiscard]] inline auto m106() {
+	return ee_mp::not_equal(true, true);
+}
+
+// m107: false != true
+[[nodiscard]] inline auto m107() {
+	return ee_mp::not_equal(false, true);
+}
+
+// m108: 1 == 1
+[[nodiscard]] inline auto m108() {
+	return ee_mp::equal(ee_mp::integer(1), ee_mp::integer(1));
+}
+
+// m109: 1 == 2
+[[nodiscard]] inline auto m109() {
+	return ee_mp::equal(ee_mp::integer(1), ee_mp::integer(2));
+}
+
+// m110: 1 != 1
+[[nodiscard]] inline auto m110() {
+	return ee_mp::not_equal(ee_mp::integer(1), ee_mp::integer(1));
+}
+
+// m111: 1 != 2
+[[nodiscard]] inline auto m111() {
+	return ee_mp::not_equal(ee_mp::integer(1), ee_mp::integer(2));
+}
+
+// m112: 1 < 1
+[[nodiscard]] inline auto m112() {
+	return ee_mp::less(ee_mp::integer(1), ee_mp::integer(1));
+}
+
+// m113: 1 < 2
+[[nodiscard]] inline auto m113() {
+	return ee_mp::less(ee_mp::integer(1), ee_mp::integer(2));
+}
+
+// m114: 1 <= 1
+[[nodiscard]] inline auto m114() {
+	return ee_mp::less_equal(ee_mp::integer(1), ee_mp::integer(1));
+}
+
+// m115: 1 <= 2
+[[nodiscard]] inline auto m115() {
+	return ee_mp::less_equal(ee_mp::integer(1), ee_mp::integer(2));
+}
+
+// m116: 3 <= 2
+[[nodiscard]] inline auto m116() {
+	return ee_mp::less_equal(ee_mp::integer(3), ee_mp::integer(2));
+}
+
+// m117: 1 > 1
+[[nodiscard]] inline auto m117() {
+	return ee_mp::greater(ee_mp::integer(1), ee_mp::integer(1));
+}
+
+// m118: 2 > 1
+[[nodiscard]] inline auto m118() {
+	return ee_mp::greater(ee_mp::integer(2), ee_mp::integer(1));
+}
+
+// m119: 1 >= 1
+[[nodiscard]] inline auto m119() {
+	return ee_mp::greater_equal(ee_mp::integer(1), ee_mp::integer(1));
+}
+
+// m120: 2 >= 1
+[[nodiscard]] inline auto m120() {
+	return ee_mp::greater_equal(ee_mp::integer(2), ee_mp::integer(1));
+}
+
+// m121: 2 >= 3
+[[nodiscard]] inline auto m121() {
+	return ee_mp::greater_equal(ee_mp::integer(2), ee_mp::integer(3));
+}
+
+// m122: 1.0 == 1.0
+[[nodiscard]] inline auto m122() {
+	static ee_mp::real const literal0("1.0");
+	static ee_mp::real const literal1("1.0");
+	return ee_mp::equal(literal0, literal1);
+}
+
+// m123: 1.0 == 2.0
+[[nodiscard]] inline auto m123() {
+	static ee_mp::real const literal0("1.0");
+	static ee_mp::real const literal1("2.0");
+	return ee_mp::equal(literal0, literal1);
+}
+
+// m124: 1.0 != 1.0
+[[nodiscard]] inline auto m124() {
+	static ee_mp::real const literal0("1.0");
+	static ee_mp::real const literal1("1.0");
+	return ee_mp::not_equal(literal0, literal1);
+}
+
+// m125: 1.0 != 2.0
+[[nodiscard]] inline auto m125() {
+	static ee_mp::real const literal0("1.0");
+	static ee_mp::real const literal1("2.0");
+	return ee_mp::not_equal(literal0, literal1);
+}
+
+// m126: 1.0 < 1.0
+[[nodiscard]] inline auto m126() {
+	static ee_mp::real const literal0("1.0");
+	static ee_mp::real const literal1("1.0");
+	return ee_mp::less(literal0, literal1);
+}
+
+// m127: 1.0 < 2.0
+[[nodiscard]] inline auto m127() {
+	static ee_mp::real const literal0("1.0");
+	static ee_mp::real const literal1("2.0");
+	return ee_mp::less(literal0, literal1);
+}
+
+// m128: 1.0 <= 1.0
+[[nodiscard]] inline auto m128() {
+	static ee_mp::real const literal0("1.0");
+	static ee_mp::real const literal1("1.0");
+	return ee_mp::less_equal(literal0, literal1);
+}
+
+// m129: 1.0 <= 2.0
+[[nodiscard]] inline auto m129() {
+	static ee_mp::real const literal0("1.0");
+	static ee_mp::real const literal1("2.0");
+	return ee_mp::less_equal(literal0, literal1);
+}
+
+// m130: 2.01 <= 2.0
+[[nodiscard]] inline auto m130() {
+	static ee_mp::real const literal0("2.01");
+	static ee_mp::real const literal1("2.0");
+	return ee_mp::less_equal(literal0, literal1);
+}
+
+// m131: 1.0 > 1.0
+[[nodiscard]] inline auto m131() {
+	static ee_mp::real const literal0("1.0");
+	static ee_mp::real const literal1("1.0");
+	return ee_mp::greater(literal0, literal1);
+}
+
+// m132: 2.0 > 1.0
+[[nodiscard]] inline auto m132() {
+	static ee_mp::real const literal0("2.0");
+	static ee_mp::real const literal1("1.0");
+	return ee_mp::greater(literal0, literal1);
+}
+
+// m133: 1.0 >= 1.0
+[[nodiscard]] inline auto m133() {
+	static ee_mp::real const literal0("1.0");
+	static ee_mp::real const literal1("1.0");
+	return ee_mp::greater_equal(literal0, literal1);
+}
+
+// m134: 2.0 >= 1.0
+[[nodiscard]] inline auto m134() {
+	static ee_mp::real const literal0("2.0");
+	static ee_mp::real const literal1("1.0");
+	return ee_mp::greater_equal(literal0, literal1);
+}
+
+// m135: 1.99 >= 2.0
+[[nodiscard]] inline auto m135() {
+	static ee_mp::real const literal0("1.99");
+	static ee_mp::real const literal1("2.0");
+	return ee_mp::greater_equal(literal0, literal1);
+}
+
+// m136: true and not true
+[[nodiscard]] inline auto m136() {
+	return ee_mp::logical_and(true, ee_mp::logical_not(true));
+}
+
+// m137: true and false == not(not true or not false)
+[[nodiscard]] inline auto m137() {
+	return ee_mp::logical_and(true, ee_mp::equal(false, ee_mp::logical_not(ee_mp::logical_or(ee_mp::logical_not(true), ee_mp::logical_not(false)))));
+}
+
+// m138: 4 < 5 and 5 == 5
+[[nodiscard]] inline auto m138() {
+	return ee_mp::logical_and(ee_mp::less(ee_mp::integer(4), ee_mp::integer(5)), ee_mp::equal(ee_mp::integer(5), ee_mp::integer(5)));
+}
+
+// m139: a and b == not(not a or not b)
+template <typename T0, typename T1>
+[[nodiscard]] auto m139(T0 const& a_, T1 const& b_) {
+	return ee_mp::logical_and(a_, ee_mp::equal(b_, ee_mp::logical_not(ee_mp::logical_or(ee_mp::logical_not(a_), ee_mp::logical_not(b_)))));
+}
+
+// m140: 1+1
+[[nodiscard]] inline auto m140() {
+	return ee_mp::add(ee_mp::integer(1), ee_mp::integer(1));
+}
+
+// m141: 2+2
+[[nodiscard]] inline auto m141() {
+	return ee_mp::add(ee_mp::integer(2), ee_mp::integer(2));
+}
+
+// m142: if(1 < 2, 10, 20)
+[[nodiscard]] inline auto m142() {
+	return ee_mp::conditional(ee_mp::less(ee_mp::integer(1), ee_mp::integer(2)), [&] { return ee_mp::integer(10); }, [&] { return ee_mp::integer(20); });
+}
+
+// m143: 1 + if(false, 10, 20) * 2
+[[nodiscard]] inline auto m143() {
+	return ee_mp::add(ee_mp::integer(1), ee_mp::multiply(ee_mp::conditional(false, [&] { return ee_mp::integer(10); }, [&] { return ee_mp::integer(20); }), ee_mp::integer(2)));
+}
+
+// m144: if(if(false, true, false), 1, if(true, 5, 6))
+[[nodiscard]] inline auto m144() {
+	return ee_mp::conditional(ee_mp::conditional(false, [&] { return true; }, [&] { return false; }), [&] { return ee_mp::integer(1); }, [&] { return ee_mp::conditional(true, [&] { return ee_mp::integer(5); }, [&] { return ee_mp::integer(6); }); });
+}
+
+// m145: if(true, 3, 1/0)
+[[nodiscard]] inline auto m145() {
+	return ee_mp::conditional(true, [&] { return ee_mp::integer(3); }, [&] { return ee_mp::divide(ee_mp::integer(1), ee_mp::integer(0)); });
+}
+
+// m146: -7 % 3
+[[nodiscard]] inline auto m146() {
+	return ee_mp::modulus(ee_mp::negate(ee_mp::integer(7)), ee_mp::integer(3));
+}
+
+// m147: (-2)**99
+[[nodiscard]] inline auto m147() {
+	return ee_mp::power(ee_mp::negate(ee_mp::integer(2)), ee_mp::integer(99));
+}
+
+// m148: (-4)**3
+[[nodiscard]] inline auto m148() {
+	return ee_mp::power(ee_mp::negate(ee_mp::integer(4)), ee_mp::integer(3));
+}
+
+// m149: 100001!
+[[nodiscard]] inline auto m149() {
+	return ee_mp::factorial(ee_mp::integer(100001));
+}
+
+// m150: (2-5)!
+[[nodiscard]] inline auto m150() {
+	return ee_mp::factorial(ee_mp::subtract(ee_mp::integer(2), ee_mp::integer(5)));
+}
+
+// m151: 3**1000000
+[[nodiscard]] inline auto m151() {
+	return ee_mp::power(ee_mp::integer(3), ee_mp::integer(1000000));
+}
+
+// m152: 1/0
+[[nodiscard]] inline auto m152() {
+	return ee_mp::divide(ee_mp::integer(1), ee_mp::integer(0));
+}
+
+// m153: 7%0
+[[nodiscard]] inline auto m153() {
+	return ee_mp::modulus(ee_mp::integer(7), ee_mp::integer(0));
+}
@@ -0,0 +1,538 @@
+#pragma once
+// Generated from ut_emit_cpp_native_corpus.txt by: ee --emit-cpp --native --no-fold ut_emit_cpp_native_corpus.txt
+
+// Helpers of the functions written by emit_cpp().
+#ifndef EE_GENERATED_NATIVE
+#define EE_GENERATED_NATIVE
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ee_native {
+	using integer = std::int64_t;
+	using real = double;
+
+	[[nodiscard]] inline real real_abs(real x) { return std::fabs(x); }
+	[[nodiscard]] inline real real_acos(real x) { return std::acos(x); }
+	[[nodiscard]] inline real real_asin(real x) { return std::asin(x); }
+	[[nodiscard]] inline real real_atan(real x) { return std::atan(x); }
+	[[nodiscard]] inline real real_atan2(real y, real x) { return std::atan2(y, x); }
+	[[nodiscard]] inline real real_ceil(real x) { return std::ceil(x); }
+	[[nodiscard]] inline real real_cos(real x) { return std::cos(x); }
+	[[nodiscard]] inline real real_exp(real x) { return std::exp(x); }
+	[[nodiscard]] inline real real_floor(real x) { return std::floor(x); }
+	[[nodiscard]] inline real real_fmod(real l, real r) { return std::fmod(l, r); }
+	[[nodiscard]] inline real real_lb(real x) { return std::log2(x); }
+	[[nodiscard]] inline real real_ln(real x) { return std::log(x); }
+	[[nodiscard]] inline real real_log(real x) { return std::log10(x); }
+	[[nodiscard]] inline real real_pow(real x, real y) { return std::pow(x, y); }
+	[[nodiscard]] inline real real_sin(real x) { return std::sin(x); }
+	[[nodiscard]] inline real real_sqrt(real x) { return std::sqrt(x); }
+	[[nodiscard]] inline real real_tan(real x) { return std::tan(x); }
+
+	// Factorial::max_argument and Power::max_result_bits when the code was written
+	inline constexpr std::uint64_t max_factorial_argument = 100000;
+	inline constexpr std::uint64_t max_power_result_bits = 1000000;
+
+	inline constexpr integer integer_min = std::numeric_limits<integer>::min();
+	inline constexpr integer integer_max = std::numeric_limits<integer>::max();
+
+	// Integer arithmetic throws where the interpreter's result does not fit, instead of
+	// overflowing, which is undefined for signed integers.
+	[[noreturn]] inline void integer_overflow() { throw std::runtime_error("Error: integer overflow"); }
+
+	[[nodiscard]] inline integer integer_add(integer l, integer r) {
+		if (r > 0 ? l > integer_max - r : l < integer_min - r)
+			integer_overflow();
+		return l + r;
+	}
+
+	[[nodiscard]] inline integer integer_subtract(integer l, integer r) {
+		if (r < 0 ? l > integer_max + r : l < integer_min + r)
+			integer_overflow();
+		return l - r;
+	}
+
+	[[nodiscard]] inline integer integer_multiply(integer l, integer r) {
+		bool const overflows = l > 0
+			? (r > 0 ? l > integer_max / r : r < integer_min / l)
+			: (r > 0 ? l < integer_min / r : l != 0 && r < integer_max / l);
+		if (overflows)
+			integer_overflow();
+		return l * r;
+	}
+
+	[[nodiscard]] inline integer integer_divide(integer l, integer r) {
+		if (l == integer_min && r == -1)
+			integer_overflow();
+		return l / r;
+	}
+
+	[[nodiscard]] inline integer integer_modulus(integer l, integer r) { return r == -1 ? 0 : l % r; }
+
+	[[nodiscard]] inline integer integer_negate(integer x) {
+		if (x == integer_min)
+			integer_overflow();
+		return -x;
+	}
+
+	[[nodiscard]] inline integer integer_abs(integer x) { return x < 0 ? integer_negate(x) : x; }
+
+	[[nodiscard]] inline real real_power(real base, integer exponent) { return std::pow(base, real(exponent)); }
+
+	[[nodiscard]] inline integer integer_power(integer base, integer exponent) {
+		if (base == 0)
+			return exponent == 0 ? 1 : 0;
+		if (base == 1)
+			return 1;
+		if (base == -1)
+			return exponent % 2 != 0 ? -1 : 1;
+		// halving towards zero counts the bits of the base without negating it
+		std::uint64_t bits = 0;
+		bool powerOfTwo = true;
+		for (integer m = base; m != 0; m /= 2) {
+			++bits;
+			powerOfTwo &= m % 2 == 0 || m / 2 == 0;
+		}
+		if (static_cast<std::uint64_t>(exponent) > max_power_result_bits / (powerOfTwo ? bits - 1 : bits))
+			throw std::runtime_error("Error: power result too large");
+		integer result = 1;
+		for (;;) {
+			if (exponent % 2 != 0)
+				result = integer_multiply(result, base);
+			exponent /= 2;
+			if (exponent == 0)
+				return result;
+			base = integer_multiply(base, base);
+		}
+	}
+
+	[[nodiscard]] inline integer integer_factorial(integer n) {
+		if (n < 0)
+			throw std::runtime_error("Error: factorial of a negative number");
+		if (static_cast<std::uint64_t>(n) > max_factorial_argument)
+			throw std::runtime_error("Error: factorial argument too large");
+		integer result = 1;
+		for (integer i = 2; i <= n; ++i)
+			result = integer_multiply(result, i);
+		return result;
+	}
+
+	template <typename T> inline constexpr bool is_integer_v = std::is_same_v<T, integer>;
+	template <typename T> inline constexpr bool is_real_v = std::is_same_v<T, real>;
+	template <typename T> inline constexpr bool is_number_v = is_integer_v<T> || is_real_v<T>;
+	template <typename T> inline constexpr bool is_boolean_v = std::is_same_v<T, bool>;
+
+	/*! Integer when both operands are Integers, otherwise Real. */
+	template <typename L, typename R>
+	using promoted_t = std::conditional_t<is_integer_v<L> && is_integer_v<R>, integer, real>;
+
+	template <typename T>
+	[[nodiscard]] real to_real(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand is not a number");
+		return real(x);
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> add(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return integer_add(l, r);
+		else
+			return T(T(l) + T(r));
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> subtract(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return integer_subtract(l, r);
+		else
+			return T(T(l) - T(r));
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> multiply(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return integer_multiply(l, r);
+		else
+			return T(T(l) * T(r));
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> divide(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>) {
+			if (r == 0)
+				throw std::runtime_error("Error: division by zero");
+			return integer_divide(l, r);
+		}
+		else
+			return T(T(l) / T(r));
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> modulus(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>) {
+			if (r == 0)
+				throw std::runtime_error("Error: division by zero");
+			return integer_modulus(l, r);
+		}
+		else
+			return real_fmod(T(l), T(r));
+	}
+
+	/*! An Integer raised to a negative Integer power would be a Real, so it throws. */
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> power(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		if constexpr (is_integer_v<L> && is_integer_v<R>) {
+			if (r < 0)
+				throw std::runtime_error("Error: negative exponent of an integer");
+			return integer_power(l, r);
+		}
+		else if constexpr (is_integer_v<R>)
+			return real_power(l, r);
+		else
+			return real_pow(to_real(l), to_real(r));
+	}
+
+	template <typename T>
+	[[nodiscard]] T identity(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand must be a number");
+		return x;
+	}
+
+	template <typename T>
+	[[nodiscard]] T negate(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand must be a number");
+		if constexpr (is_integer_v<T>)
+			return integer_negate(x);
+		else
+			return T(-x);
+	}
+
+	template <typename T>
+	[[nodiscard]] integer factorial(T const& n) {
+		static_assert(is_integer_v<T>, "Error: factorial requires an integer");
+		return integer_factorial(n);
+	}
+
+	template <typename T>
+	[[nodiscard]] bool logical_not(T const& x) {
+		static_assert(is_boolean_v<T>, "Error: operand must be a boolean");
+		return !x;
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_and(L const& l, R const& r) {
+		static_assert(is_boolean_v<L> && is_boolean_v<R>, "Error: operands must be booleans");
+		return l && r;
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_or(L const& l, R const& r) {
+		static_assert(is_boolean_v<L> && is_boolean_v<R>, "Error: operands must be booleans");
+		return l || r;
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_xor(L const& l, R const& r) {
+		static_assert(is_boolean_v<L> && is_boolean_v<R>, "Error: operands must be booleans");
+		return l != r;
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_nand(L const& l, R const& r) { return !logical_and(l, r); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_nor(L const& l, R const& r) { return !logical_or(l, r); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_xnor(L const& l, R const& r) { return !logical_xor(l, r); }
+
+	/*! Numeric comparison, or boolean comparison (false < true) of two booleans. */
+	template <typename L, typename R, typename COMPARE>
+	[[nodiscard]] bool compare(L const& l, R const& r, COMPARE compare) {
+		if constexpr (is_boolean_v<L> && is_boolean_v<R>)
+			return compare(l, r);
+		else {
+			static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+			using T = promoted_t<L, R>;
+			return compare(T(l), T(r));
+		}
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool equal(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a == b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool not_equal(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a != b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool less(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a < b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool less_equal(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a <= b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool greater(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a > b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool greater_equal(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a >= b; }); }
+
+	template <typename T>
+	[[nodiscard]] T abs(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand is not a number");
+		if constexpr (is_integer_v<T>)
+			return integer_abs(x);
+		else
+			return real_abs(x);
+	}
+
+	template <typename T>
+	[[nodiscard]] T ceil(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand is not a number");
+		if constexpr (is_integer_v<T>)
+			return x;
+		else
+			return real_ceil(x);
+	}
+
+	template <typename T>
+	[[nodiscard]] T floor(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand is not a number");
+		if constexpr (is_integer_v<T>)
+			return x;
+		else
+			return real_floor(x);
+	}
+
+	template <typename T> [[nodiscard]] real arccos(T const& x) { return real_acos(to_real(x)); }
+	template <typename T> [[nodiscard]] real arcsin(T const& x) { return real_asin(to_real(x)); }
+	template <typename T> [[nodiscard]] real arctan(T const& x) { return real_atan(to_real(x)); }
+	template <typename T> [[nodiscard]] real cos(T const& x) { return real_cos(to_real(x)); }
+	template <typename T> [[nodiscard]] real exp(T const& x) { return real_exp(to_real(x)); }
+	template <typename T> [[nodiscard]] real lb(T const& x) { return real_lb(to_real(x)); }
+	template <typename T> [[nodiscard]] real ln(T const& x) { return real_ln(to_real(x)); }
+	template <typename T> [[nodiscard]] real log(T const& x) { return real_log(to_real(x)); }
+	template <typename T> [[nodiscard]] real sin(T const& x) { return real_sin(to_real(x)); }
+	template <typename T> [[nodiscard]] real sqrt(T const& x) { return real_sqrt(to_real(x)); }
+	template <typename T> [[nodiscard]] real tan(T const& x) { return real_tan(to_real(x)); }
+
+	template <typename Y, typename X>
+	[[nodiscard]] real arctan2(Y const& y, X const& x) { return real_atan2(to_real(y), to_real(x)); }
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> maximum(L const& l, R const& r) {
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return l >= r ? l : r;
+		else {
+			auto const a = to_real(l), b = to_real(r);
+			return a >= b ? a : b;
+		}
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> minimum(L const& l, R const& r) {
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return l <= r ? l : r;
+		else {
+			auto const a = to_real(l), b = to_real(r);
+			return a <= b ? a : b;
+		}
+	}
+
+	/*! if(): evaluates one branch; numeric branches of different types are converted to Real. */
+	template <typename C, typename THEN, typename ELSE>
+	[[nodiscard]] auto conditional(C const& condition, THEN const& then, ELSE const& otherwise) {
+		static_assert(is_boolean_v<C>, "Error: condition must be a boolean");
+		using A = decltype(then());
+		using B = decltype(otherwise());
+		static_assert(std::is_same_v<A, B> || (is_number_v<A> && is_number_v<B>), "Error: the branches of if() have different types");
+		using T = std::conditional_t<std::is_same_v<A, B>, A, promoted_t<A, B>>;
+		return condition ? T(then()) : T(otherwise());
+	}
+}
+#endif
+
+// n001: 42
+[[nodiscard]] inline auto n001() {
+	return ee_native::integer(42);
+}
+
+// n002: 2+3
+[[nodiscard]] inline auto n002() {
+	return ee_native::add(ee_native::integer(2), ee_native::integer(3));
+}
+
+// n003: 2-32/4
+[[nodiscard]] inline auto n003() {
+	return ee_native::subtract(ee_native::integer(2), ee_native::divide(ee_native::integer(32), ee_native::integer(4)));
+}
+
+// n004: 23/3
+[[nodiscard]] inline auto n004() {
+	return ee_native::divide(ee_native::integer(23), ee_native::integer(3));
+}
+
+// n005: -7 % 3
+[[nodiscard]] inline auto n005() {
+	return ee_native::modulus(ee_native::negate(ee_native::integer(7)), ee_native::integer(3));
+}
+
+// n006: 5!
+[[nodiscard]] inline auto n006() {
+	return ee_native::factorial(ee_native::integer(5));
+}
+
+// n007: 20!
+[[nodiscard]] inline auto n007() {
+	return ee_native::factorial(ee_native::integer(20));
+}
+
+// n008: -7**2
+[[nodiscard]] inline auto n008() {
+	return ee_native::negate(ee_native::power(ee_native::integer(7), ee_native::integer(2)));
+}
+
+// n009: 3**39
+[[nodiscard]] inline auto n009() {
+	return ee_native::power(ee_native::integer(3), ee_native::integer(39));
+}
+
+// n010: (-2)**63
+[[nodiscard]] inline auto n010() {
+	return ee_native::power(ee_native::negate(ee_native::integer(2)), ee_native::integer(63));
+}
+
+// n011: (4 + 2 * 5) / (1 + 3 * 2)
+[[nodiscard]] inline auto n011() {
+	return ee_native::divide(ee_native::add(ee_native::integer(4), ee_native::multiply(ee_native::integer(2), ee_native::integer(5))), ee_native::add(ee_native::integer(1), ee_native::multiply(ee_native::integer(3), ee_native::integer(2))));
+}
+
+// n012: 1 <= 2
+[[nodiscard]] inline auto n012() {
+	return ee_native::less_equal(ee_native::integer(1), ee_native::integer(2));
+}
+
+// n013: 4 < 5 and 5 == 5
+[[nodiscard]] inline auto n013() {
+	return ee_native::logical_and(ee_native::less(ee_native::integer(4), ee_native::integer(5)), ee_native::equal(ee_native::integer(5), ee_native::integer(5)));
+}
+
+// n014: if(1 < 2, 10, 20)
+[[nodiscard]] inline auto n014() {
+	return ee_native::conditional(ee_native::less(ee_native::integer(1), ee_native::integer(2)), [&] { return ee_native::integer(10); }, [&] { return ee_native::integer(20); });
+}
+
+// n015: if(if(false, true, false), 1, if(true, 5, 6))
+[[nodiscard]] inline auto n015() {
+	return ee_native::conditional(ee_native::conditional(false, [&] { return true; }, [&] { return false; }), [&] { return ee_native::integer(1); }, [&] { return ee_native::conditional(true, [&] { return ee_native::integer(5); }, [&] { return ee_native::integer(6); }); });
+}
+
+// n016: if(true, 3, 1/0)
+[[nodiscard]] inline auto n016() {
+	return ee_native::conditional(true, [&] { return ee_native::integer(3); }, [&] { return ee_native::divide(ee_native::integer(1), ee_native::integer(0)); });
+}
+
+// n017: abs(-4)
+[[nodiscard]] inline auto n017() {
+	return ee_native::abs(ee_native::negate(ee_native::integer(4)));
+}
+
+// n018: 5.5/1.1
+[[nodiscard]] inline auto n018() {
+	return ee_native::divide(5.5, 1.1000000000000001);
+}
+
+// n019: 4.0 ** 0.5
+[[nodiscard]] inline auto n019() {
+	return ee_native::power(4.0, 0.5);
+}
+
+// n020: sin(1.0)**2+cos(1.0)**2
+[[nodiscard]] inline auto n020() {
+	return ee_native::add(ee_native::power(ee_native::sin(1.0), ee_native::integer(2)), ee_native::power(ee_native::cos(1.0), ee_native::integer(2)));
+}
+
+// n021: 5/2.0
+[[nodiscard]] inline auto n021() {
+	return ee_native::divide(ee_native::integer(5), 2.0);
+}
+
+// n022: 1.0/(1.0/32.0+1.0/48.0)
+[[nodiscard]] inline auto n022() {
+	return ee_native::divide(1.0, ee_native::add(ee_native::divide(1.0, 32.0), ee_native::divide(1.0, 48.0)));
+}
+
+// n023: (-9223372036854775807 - 1) % (0 - 1)
+[[nodiscard]] inline auto n023() {
+	return ee_native::modulus(ee_native::subtract(ee_native::negate(ee_native::integer(9223372036854775807)), ee_native::integer(1)), ee_native::subtract(ee_native::integer(0), ee_native::integer(1)));
+}
+
+// n024: 9223372036854775807 + 1
+[[nodiscard]] inline auto n024() {
+	return ee_native::add(ee_native::integer(9223372036854775807), ee_native::integer(1));
+}
+
+// n025: -9223372036854775807 - 2
+[[nodiscard]] inline auto n025() {
+	return ee_native::subtract(ee_native::negate(ee_native::integer(9223372036854775807)), ee_native::integer(2));
+}
+
+// n026: 3037000500 * 3037000500
+[[nodiscard]] inline auto n026() {
+	return ee_native::multiply(ee_native::integer(3037000500), ee_native::integer(3037000500));
+}
+
+// n027: (-9223372036854775807 - 1) / (0 - 1)
+[[nodiscard]] inline auto n027() {
+	return ee_native::divide(ee_native::subtract(ee_native::negate(ee_native::integer(9223372036854775807)), ee_native::integer(1)), ee_native::subtract(ee_native::integer(0), ee_native::integer(1)));
+}
+
+// n028: -(-9223372036854775807 - 1)
+[[nodiscard]] inline auto n028() {
+	return ee_native::negate(ee_native::subtract(ee_native::negate(ee_native::integer(9223372036854775807)), ee_native::integer(1)));
+}
+
+// n029: abs(-9223372036854775807 - 1)
+[[nodiscard]] inline auto n029() {
+	return ee_native::abs(ee_native::subtract(ee_native::negate(ee_native::integer(9223372036854775807)), ee_native::integer(1)));
+}
+
+// n030: 21!
+[[nodiscard]] inline auto n030() {
+	return ee_native::factorial(ee_native::integer(21));
+}
+
+// n031: 2**63
+[[nodiscard]] inline auto n031() {
+	return ee_native::power(ee_native::integer(2), ee_native::integer(63));
+}
+
+// n032: 3**40
+[[nodiscard]] inline auto n032() {
+	return ee_native::power(ee_native::integer(3), ee_native::integer(40));
+}
+
+// n033: 100001!
+[[nodiscard]] inline auto n033() {
+	return ee_native::factorial(ee_native::integer(100001));
+}
+
+// n034: 1/0
+[[nodiscard]] inline auto n034() {
+	return ee_native::divide(ee_native::integer(1), ee_native::integer(0));
+}
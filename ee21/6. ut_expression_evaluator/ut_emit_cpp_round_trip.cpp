@@ -0,0 +1,375 @@
+/*! \file	ut_emit_cpp_round_trip.cpp
+	\brief	C++ emitter round-trip unit test.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor
+
+=============================================================
+Round trip of the C++ emitter: every expression of the marker
+tests (except assignments and result()) is in
+ut_emit_cpp_corpus.txt, with if()s and the interpreter's errors,
+and ut_emit_cpp_emitted.hpp is the output of
+	ee --emit-cpp --no-fold ut_emit_cpp_corpus.txt
+ut_emit_cpp_native.hpp is the output of
+	ee --emit-cpp --native --no-fold ut_emit_cpp_native_corpus.txt
+Without folding the helpers compute every value.  Each emitted
+function must produce the value the interpreter produces, or
+throw the same error; Native Reals need only be close, and
+Native Integers that do not fit must throw.  The headers must
+match what the emitter writes now, so regenerate them when the
+emitter changes.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Moved from the marker to the unit tests.
+	The corpus is emitted unfolded, with if()s, errors and a Native corpus,
+	and the headers are compared with the emitter's output.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include <gats/TestApp.hpp>
+#include "ut_test_phases.hpp"
+#include <ee/expression_evaluator.hpp>
+#include <ee/boolean.hpp>
+#include <ee/integer.hpp>
+#include <ee/real.hpp>
+#include <ee/variable.hpp>
+
+#if TEST_EMIT_CPP
+#include "ut_emit_cpp_emitted.hpp"
+#include "ut_emit_cpp_native.hpp"
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+	[[nodiscard]] Operand::pointer_type operand_of(ee_mp::integer const& value) { return make_operand<Integer>(value); }
+	[[nodiscard]] Operand::pointer_type operand_of(ee_mp::real const& value) { return make_operand<Real>(value); }
+	[[nodiscard]] Operand::pointer_type operand_of(bool value) { return make_operand<Boolean>(value); }
+
+	[[nodiscard]] Operand::pointer_type native_operand_of(ee_native::integer value) { return make_operand<Integer>(Integer::value_type(value)); }
+	[[nodiscard]] Operand::pointer_type native_operand_of(ee_native::real value) { return make_operand<Real>(Real::value_type(value)); }
+	[[nodiscard]] Operand::pointer_type native_operand_of(bool value) { return make_operand<Boolean>(value); }
+
+	/*! True if both are Integers, Reals, or Booleans of the same value. */
+	[[nodiscard]] bool same_value(Token::pointer_type const& expected, Token::pointer_type const& actual) {
+		return is<Integer>(expected) == is<Integer>(actual)
+			&& is<Real>(expected) == is<Real>(actual)
+			&& is<Boolean>(expected) == is<Boolean>(actual)
+			&& expected->str() == actual->str();
+	}
+
+	/*! True if both are Reals within a relative 1e-12, as doubles are. */
+	[[nodiscard]] bool close_value(Token::pointer_type const& expected, Token::pointer_type const& actual) {
+		if (!is<Real>(expected) || !is<Real>(actual))
+			return same_value(expected, actual);
+		auto const e = value_of<Real>(expected).convert_to<double>(), a = value_of<Real>(actual).convert_to<double>();
+		return std::fabs(e - a) <= 1e-12 * std::fmax(1.0, std::fabs(e));
+	}
+
+	/*! A value, or the message of the error thrown instead. */
+	struct Outcome {
+		Operand::pointer_type	value;
+		std::string				error;
+	};
+
+	[[nodiscard]] Outcome outcome_of(std::function<Operand::pointer_type()> const& compute) {
+		try {
+			return { compute(), {} };
+		}
+		catch (std::exception const& e) {
+			return { nullptr, e.what() };
+		}
+	}
+
+	[[nodiscard]] std::string str(Outcome const& outcome) { return outcome.value ? outcome.value->str() : outcome.error; }
+
+	/*! The interpreter's outcome for 'expression'. */
+	[[nodiscard]] Outcome interpreted(char const* expression) {
+		return outcome_of([=] { return dereference(std::static_pointer_cast<Operand>(ExpressionEvaluator().evaluate(expression))); });
+	}
+
+	/*! The text of the header emit_cpp() writes for the corpus next to this file, as ee writes it. */
+	[[nodiscard]] std::string emit_corpus(char const* corpus, CppNumbers numbers) {
+		std::ifstream file(std::filesystem::path(__FILE__).replace_filename(corpus));
+		ExpressionEvaluator ee;
+		std::ostringstream os;
+		emit_cpp_prelude(os, numbers);
+		for (std::string line; std::getline(file, line); ) {
+			auto const colon = line.find(": ");
+			auto const name = line.substr(0, colon), expression = line.substr(colon + 2);
+			os << "\n// " << name << ": " << expression << '\n';
+			ee.emit_cpp(ee.compile(expression), name, numbers, os, CppFolding::None);
+		}
+		return os.str();
+	}
+
+	/*! The checked-in header next to this file, without its first three lines. */
+	[[nodiscard]] std::string checked_in(char const* header) {
+		std::ifstream file(std::filesystem::path(__FILE__).replace_filename(header));
+		std::string line;
+		for (int i = 0; i < 3; ++i)
+			std::getline(file, line);
+		std::ostringstream os;
+		os << file.rdbuf();
+		return os.str();
+	}
+
+	struct EmittedCase {
+		char const*								expression;
+		std::function<Operand::pointer_type()>	emitted;
+	};
+
+	std::vector<EmittedCase> const EMITTED_CASES = {
+		{ "1000", [] { return operand_of(m001()); } },
+		{ "42", [] { return operand_of(m002()); } },
+		{ "0", [] { return operand_of(m003()); } },
+		{ "-42", [] { return operand_of(m004()); } },
+		{ "123456789012345678901234567890123456789012345678901234567890", [] { return operand_of(m005()); } },
+		{ "+42", [] { return operand_of(m006()); } },
+		{ "5!", [] { return operand_of(m007()); } },
+		{ "100!", [] { return operand_of(m008()); } },
+		{ "2+3", [] { return operand_of(m009()); } },
+		{ "2-3", [] { return operand_of(m010()); } },
+		{ "2*3", [] { return operand_of(m011()); } },
+		{ "21/3", [] { return operand_of(m012()); } },
+		{ "23/3", [] { return operand_of(m013()); } },
+		{ "21%3", [] { return operand_of(m014()); } },
+		{ "23%3", [] { return operand_of(m015()); } },
+		{ "5**2", [] { return operand_of(m016()); } },
+		{ "123**123", [] { return operand_of(m017()); } },
+		{ "-7**2", [] { return operand_of(m018()); } },
+		{ "2*3+4", [] { return operand_of(m019()); } },
+		{ "21/3-5", [] { return operand_of(m020()); } },
+		{ "2+3*4", [] { return operand_of(m021()); } },
+		{ "2-32/4", [] { return operand_of(m022()); } },
+		{ "4!!", [] { return operand_of(m023()); } },
+		{ "2*4!-4", [] { return operand_of(m024()); } },
+		{ "20*3-32/4", [] { return operand_of(m025()); } },
+		{ "(21+5)/(7+6)", [] { return operand_of(m026()); } },
+		{ "(5+6*7)*(4+3)/(1+(5+6*7))", [] { return operand_of(m027()); } },
+		{ "(4 + 2 * 5) / (1 + 3 * 2)", [] { return operand_of(m028()); } },
+		{ "23 mod 3", [] { return operand_of(m029()); } },
+		{ "15 mod 6 * 3", [] { return operand_of(m030()); } },
+		{ "4**3**2", [] { return operand_of(m031()); } },
+		{ "(2)", [] { return operand_of(m032()); } },
+		{ "((2))", [] { return operand_of(m033()); } },
+		{ "(3+4)*5", [] { return operand_of(m034()); } },
+		{ "((1+2)*3)-4*(2-3)", [] { return operand_of(m035()); } },
+		{ "(2**3)**4", [] { return operand_of(m036()); } },
+		{ "abs(4)", [] { return operand_of(m037()); } },
+		{ "abs(-4)", [] { return operand_of(m038()); } },
+		{ "1234.5678", [] { return operand_of(m039()); } },
+		{ "123456789012345678901234567890123456789012345678901234567890.123456789012345678901234567890123456789012345678901234567890", [] { return operand_of(m040()); } },
+		{ "e", [] { return operand_of(m041()); } },
+		{ "E", [] { return operand_of(m042()); } },
+		{ "pi", [] { return operand_of(m043()); } },
+		{ "Pi", [] { return operand_of(m044()); } },
+		{ "PI", [] { return operand_of(m045()); } },
+		{ "+42.3", [] { return operand_of(m046()); } },
+		{ "-42.3", [] { return operand_of(m047()); } },
+		{ "2.2+3.3", [] { return operand_of(m048()); } },
+		{ "2.2-3.3", [] { return operand_of(m049()); } },
+		{ "2.5*3.5", [] { return operand_of(m050()); } },
+		{ "5.5/1.1", [] { return operand_of(m051()); } },
+		{ "4.0 ** 0.5", [] { return operand_of(m052()); } },
+		{ "cos(0.0)", [] { return operand_of(m053()); } },
+		{ "arccos(1.0)", [] { return operand_of(m054()); } },
+		{ "sin(0.0)", [] { return operand_of(m055()); } },
+		{ "arcsin(1.0)", [] { return operand_of(m056()); } },
+		{ "tan(0.0)", [] { return operand_of(m057()); } },
+		{ "arctan(0.0)", [] { return operand_of(m058()); } },
+		{ "abs(4.0)", [] { return operand_of(m059()); } },
+		{ "abs(-4.0)", [] { return operand_of(m060()); } },
+		{ "ceil(4.3)", [] { return operand_of(m061()); } },
+		{ "ceil(-4.3)", [] { return operand_of(m062()); } },
+		{ "exp(1.0)", [] { return operand_of(m063()); } },
+		{ "floor(4.3)", [] { return operand_of(m064()); } },
+		{ "floor(-4.3)", [] { return operand_of(m065()); } },
+		{ "lb(8.0)", [] { return operand_of(m066()); } },
+		{ "ln(1.0)", [] { return operand_of(m067()); } },
+		{ "sqrt(16.0)", [] { return operand_of(m068()); } },
+		{ "1.0/(1.0/32.0+1.0/48.0)", [] { return operand_of(m069()); } },
+		{ "sin(1.0)**2+cos(1.0)**2", [] { return operand_of(m070()); } },
+		{ "1+3.3", [] { return operand_of(m071()); } },
+		{ "5/2.0", [] { return operand_of(m072()); } },
+		{ "5.0/2", [] { return operand_of(m073()); } },
+		{ "true", [] { return operand_of(m074()); } },
+		{ "True", [] { return operand_of(m075()); } },
+		{ "TRUE", [] { return operand_of(m076()); } },
+		{ "false", [] { return operand_of(m077()); } },
+		{ "False", [] { return operand_of(m078()); } },
+		{ "FALSE", [] { return operand_of(m079()); } },
+		{ "true and true", [] { return operand_of(m080()); } },
+		{ "true and false", [] { return operand_of(m081()); } },
+		{ "false and true", [] { return operand_of(m082()); } },
+		{ "false and false", [] { return operand_of(m083()); } },
+		{ "true or true", [] { return operand_of(m084()); } },
+		{ "true or false", [] { return operand_of(m085()); } },
+		{ "false or true", [] { return operand_of(m086()); } },
+		{ "false or false", [] { return operand_of(m087()); } },
+		{ "true xor true", [] { return operand_of(m088()); } },
+		{ "true xor false", [] { return operand_of(m089()); } },
+		{ "false xor true", [] { return operand_of(m090()); } },
+		{ "false xor false", [] { return operand_of(m091()); } },
+		{ "true nand true", [] { return operand_of(m092()); } },
+		{ "true nand false", [] { return operand_of(m093()); } },
+		{ "false nand true", [] { return operand_of(m094()); } },
+		{ "false nand false", [] { return operand_of(m095()); } },
+		{ "true nor true", [] { return operand_of(m096()); } },
+		{ "true nor false", [] { return operand_of(m097()); } },
+		{ "false nor true", [] { return operand_of(m098()); } },
+		{ "false nor false", [] { return operand_of(m099()); } },
+		{ "true xnor true", [] { return operand_of(m100()); } },
+		{ "true xnor false", [] { return operand_of(m101()); } },
+		{ "false xnor true", [] { return operand_of(m102()); } },
+		{ "false xnor false", [] { return operand_of(m103()); } },
+		{ "true == true", [] { return operand_of(m104()); } },
+		{ "false == true", [] { return operand_of(m105()); } },
+		{ "true != true", [] { return operand_of(m106()); } },
+		{ "false != true", [] { return operand_of(m107()); } },
+		{ "1 == 1", [] { return operand_of(m108()); } },
+		{ "1 == 2", [] { return operand_of(m109()); } },
+		{ "1 != 1", [] { return operand_of(m110()); } },
+		{ "1 != 2", [] { return operand_of(m111()); } },
+		{ "1 < 1", [] { return operand_of(m112()); } },
+		{ "1 < 2", [] { return operand_of(m113()); } },
+		{ "1 <= 1", [] { return operand_of(m114()); } },
+		{ "1 <= 2", [] { return operand_of(m115()); } },
+		{ "3 <= 2", [] { return operand_of(m116()); } },
+		{ "1 > 1", [] { return operand_of(m117()); } },
+		{ "2 > 1", [] { return operand_of(m118()); } },
+		{ "1 >= 1", [] { return operand_of(m119()); } },
+		{ "2 >= 1", [] { return operand_of(m120()); } },
+		{ "2 >= 3", [] { return operand_of(m121()); } },
+		{ "1.0 == 1.0", [] { return operand_of(m122()); } },
+		{ "1.0 == 2.0", [] { return operand_of(m123()); } },
+		{ "1.0 != 1.0", [] { return operand_of(m124()); } },
+		{ "1.0 != 2.0", [] { return operand_of(m125()); } },
+		{ "1.0 < 1.0", [] { return operand_of(m126()); } },
+		{ "1.0 < 2.0", [] { return operand_of(m127()); } },
+		{ "1.0 <= 1.0", [] { return operand_of(m128()); } },
+		{ "1.0 <= 2.0", [] { return operand_of(m129()); } },
+		{ "2.01 <= 2.0", [] { return operand_of(m130()); } },
+		{ "1.0 > 1.0", [] { return operand_of(m131()); } },
+		{ "2.0 > 1.0", [] { return operand_of(m132()); } },
+		{ "1.0 >= 1.0", [] { return operand_of(m133()); } },
+		{ "2.0 >= 1.0", [] { return operand_of(m134()); } },
+		{ "1.99 >= 2.0", [] { return operand_of(m135()); } },
+		{ "true and not true", [] { return operand_of(m136()); } },
+		{ "true and false == not(not true or not false)", [] { return operand_of(m137()); } },
+		{ "4 < 5 and 5 == 5", [] { return operand_of(m138()); } },
+		{ "1+1", [] { return operand_of(m140()); } },
+		{ "2+2", [] { return operand_of(m141()); } },
+		{ "if(1 < 2, 10, 20)", [] { return operand_of(m142()); } },
+		{ "1 + if(false, 10, 20) * 2", [] { return operand_of(m143()); } },
+		{ "if(if(false, true, false), 1, if(true, 5, 6))", [] { return operand_of(m144()); } },
+		{ "if(true, 3, 1/0)", [] { return operand_of(m145()); } },
+		{ "-7 % 3", [] { return operand_of(m146()); } },
+		{ "(-2)**99", [] { return operand_of(m147()); } },
+		{ "(-4)**3", [] { return operand_of(m148()); } },
+		{ "100001!", [] { return operand_of(m149()); } },
+		{ "(2-5)!", [] { return operand_of(m150()); } },
+		{ "3**1000000", [] { return operand_of(m151()); } },
+		{ "1/0", [] { return operand_of(m152()); } },
+		{ "7%0", [] { return operand_of(m153()); } },
+	};
+
+	std::vector<EmittedCase> const NATIVE_CASES = {
+		{ "42", [] { return native_operand_of(n001()); } },
+		{ "2+3", [] { return native_operand_of(n002()); } },
+		{ "2-32/4", [] { return native_operand_of(n003()); } },
+		{ "23/3", [] { return native_operand_of(n004()); } },
+		{ "-7 % 3", [] { return native_operand_of(n005()); } },
+		{ "5!", [] { return native_operand_of(n006()); } },
+		{ "20!", [] { return native_operand_of(n007()); } },
+		{ "-7**2", [] { return native_operand_of(n008()); } },
+		{ "3**39", [] { return native_operand_of(n009()); } },
+		{ "(-2)**63", [] { return native_operand_of(n010()); } },
+		{ "(4 + 2 * 5) / (1 + 3 * 2)", [] { return native_operand_of(n011()); } },
+		{ "1 <= 2", [] { return native_operand_of(n012()); } },
+		{ "4 < 5 and 5 == 5", [] { return native_operand_of(n013()); } },
+		{ "if(1 < 2, 10, 20)", [] { return native_operand_of(n014()); } },
+		{ "if(if(false, true, false), 1, if(true, 5, 6))", [] { return native_operand_of(n015()); } },
+		{ "if(true, 3, 1/0)", [] { return native_operand_of(n016()); } },
+		{ "abs(-4)", [] { return native_operand_of(n017()); } },
+		{ "5.5/1.1", [] { return native_operand_of(n018()); } },
+		{ "4.0 ** 0.5", [] { return native_operand_of(n019()); } },
+		{ "sin(1.0)**2+cos(1.0)**2", [] { return native_operand_of(n020()); } },
+		{ "5/2.0", [] { return native_operand_of(n021()); } },
+		{ "1.0/(1.0/32.0+1.0/48.0)", [] { return native_operand_of(n022()); } },
+		{ "(-9223372036854775807 - 1) % (0 - 1)", [] { return native_operand_of(n023()); } },
+		{ "9223372036854775807 + 1", [] { return native_operand_of(n024()); } },
+		{ "-9223372036854775807 - 2", [] { return native_operand_of(n025()); } },
+		{ "3037000500 * 3037000500", [] { return native_operand_of(n026()); } },
+		{ "(-9223372036854775807 - 1) / (0 - 1)", [] { return native_operand_of(n027()); } },
+		{ "-(-9223372036854775807 - 1)", [] { return native_operand_of(n028()); } },
+		{ "abs(-9223372036854775807 - 1)", [] { return native_operand_of(n029()); } },
+		{ "21!", [] { return native_operand_of(n030()); } },
+		{ "2**63", [] { return native_operand_of(n031()); } },
+		{ "3**40", [] { return native_operand_of(n032()); } },
+		{ "100001!", [] { return native_operand_of(n033()); } },
+		{ "1/0", [] { return native_operand_of(n034()); } },
+	};
+}
+
+
+
+	GATS_TEST_CASE(EE_emit_cpp_round_trip) {
+		for (auto const& test : EMITTED_CASES) {
+			auto const expected = interpreted(test.expression), actual = outcome_of(test.emitted);
+			bool const same = expected.value && actual.value ? same_value(expected.value, actual.value) : expected.error == actual.error;
+			GATS_CHECK_MESSAGE(same, test.expression << " = " << str(actual) << " should be " << str(expected));
+		}
+	}
+
+	GATS_TEST_CASE(EE_emit_cpp_native_round_trip) {
+		for (auto const& test : NATIVE_CASES) {
+			auto expected = interpreted(test.expression);
+			if (expected.value && is<Integer>(expected.value)) {
+				auto const& value = value_of<Integer>(expected.value);
+				if (value < std::numeric_limits<std::int64_t>::min() || value > std::numeric_limits<std::int64_t>::max())
+					expected = { nullptr, "Error: integer overflow" };
+			}
+			auto const actual = outcome_of(test.emitted);
+			bool const same = expected.value && actual.value ? close_value(expected.value, actual.value) : expected.error == actual.error;
+			GATS_CHECK_MESSAGE(same, test.expression << " = " << str(actual) << " should be " << str(expected));
+		}
+	}
+
+	GATS_TEST_CASE(EE_emit_cpp_headers_current) {
+		GATS_CHECK_MESSAGE(emit_corpus("ut_emit_cpp_corpus.txt", CppNumbers::Multiprecision) == checked_in("ut_emit_cpp_emitted.hpp"),
+			"ut_emit_cpp_emitted.hpp differs from the emitter's output; regenerate it");
+		GATS_CHECK_MESSAGE(emit_corpus("ut_emit_cpp_native_corpus.txt", CppNumbers::Native) == checked_in("ut_emit_cpp_native.hpp"),
+			"ut_emit_cpp_native.hpp differs from the emitter's output; regenerate it");
+	}
+
+	GATS_TEST_CASE(EE_emit_cpp_variables) {
+		ExpressionEvaluator ee;
+		auto result = ee.evaluate("a = true");
+		result = ee.evaluate("b = false");
+		result = ee.evaluate("a and b == not(not a or not b)");
+		GATS_CHECK(same_value(dereference(std::static_pointer_cast<Operand>(result)), operand_of(m139(true, false))));
+	}
+#endif // TEST_EMIT_CPP
@@ -8,6 +8,28 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added factorial table, parallel, and limit tests.
+	Added power operator fast path and result limit tests.
+	Added transcendental function accuracy test.
+	Added function cache tests.
+	Added incremental re-evaluation tests.
+	Added FormulaGraph tests.
+	Added shared program / per-thread context tests.
+	Added result history ring and spill tests.
+	Added program serialization tests.
+	Added variable slot binding test.
+	Added formula library test.
+	Added JIT program test.
+	Added static formula test.
+	Added C++ emitter test.
+	Added column evaluator test.
+	Added column selection and filter tests.
+	Added evaluation stats test.
+	Added profiler test.
+	Added evaluator bench cases.
+	Made the cases that change Factorial limits or the FunctionCache serial.
+
 Version 2021.11.01
 	C++ 20 validated
 
@@ -60,10 +82,25 @@ the program(s) have been supplied.
 #include <ee/real.hpp>
 #include <ee/variable.hpp>
 #include <ee/boolean.hpp>
-
-
-
-#if TEST_REAL
+#include <ee/operator.hpp>
+#include <ee/function.hpp>
+#include <ee/column_evaluator.hpp>
+#include <ee/column_filter.hpp>
+#include <ee/formula_graph.hpp>
+#include <ee/formula_library.hpp>
+#include <ee/jit_program.hpp>
+#include <ee/static_formula.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/evaluation_context.hpp>
+#include <filesystem>
+#include <span>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+
+
+#if TEST_REAL || TEST_TRANSCENDENTAL
 	[[nodiscard]] Real::value_type round(Real::value_type x) {
 		auto exp = pow(Real::value_type("10.0"), Real::value_type("990"));
 		x *= exp;
@@ -618,3 +655,732 @@ GATS_TEST_CASE( empty_expression ) {
 	#endif // TEST_RESULT
 #endif // TEST_VARIABLE
 
+
+
+#if TEST_CONDITIONAL
+	GATS_TEST_CASE(EE_conditional) {
+		ExpressionEvaluator ee;
+		auto result = ee.evaluate("if(1 < 2, 10, 20)");
+		GATS_CHECK(value_of<Integer>(result) == Integer::value_type("10"));
+
+		result = ee.evaluate("1 + if(false, 10, 20) * 2");
+		GATS_CHECK(value_of<Integer>(result) == Integer::value_type("41"));
+
+		result = ee.evaluate("if(if(false, true, false), 1, if(true, 5, 6))");
+		GATS_CHECK(value_of<Integer>(result) == Integer::value_type("5"));
+	}
+
+	GATS_TEST_CASE(EE_conditional_lazy) {
+		ExpressionEvaluator ee;
+		auto result = ee.evaluate("if(true, 3, 1/0)");
+		GATS_CHECK(value_of<Integer>(result) == Integer::value_type("3"));
+
+		result = ee.evaluate("if(false, 1/0, 4)");
+		GATS_CHECK(value_of<Integer>(result) == Integer::value_type("4"));
+
+		result = ee.evaluate("x = 0");
+		result = ee.evaluate("if(true, x = 1, x = 2)");
+		result = ee.evaluate("x");
+		GATS_CHECK(value_of<Integer>(convert<Variable>(result)->value()) == Integer::value_type("1"));
+	}
+
+	GATS_TEST_CASE(EE_conditional_argument_count) {
+		GATS_CHECK_THROW((void)ExpressionEvaluator().evaluate("if(true, 1)"), std::exception&);
+		GATS_CHECK_THROW((void)ExpressionEvaluator().evaluate("if(true, 1, 2, 3)"), std::exception&);
+	}
+#endif // TEST_CONDITIONAL
+
+
+
+#if TEST_WATCH
+	GATS_TEST_CASE(EE_watch_dependents) {
+		ExpressionEvaluator ee;
+		(void)ee.evaluate("x = 2");
+		(void)ee.evaluate("y = 3.5");
+		auto a = ee.watch("ln(y) * 10 + x");
+		auto b = ee.watch("sqrt(y) + 1");
+		auto c = ee.watch("x * x");
+		auto d = ee.watch("if(x > 5, ln(y), 0)");
+		GATS_CHECK(ee.update() == 0);
+
+		(void)ee.evaluate("x = 4");
+		GATS_CHECK(ee.update() == 3);
+		GATS_CHECK(value_of<Integer>(ee.watched(c)) == Integer::value_type("16"));
+		GATS_CHECK(value_of<Real>(ee.watched(a)) == value_of<Real>(ExpressionEvaluator().evaluate("ln(3.5) * 10 + 4")));
+
+		(void)ee.evaluate("x = 6");
+		GATS_CHECK(ee.update() == 3);
+		GATS_CHECK(value_of<Real>(ee.watched(d)) == value_of<Real>(ExpressionEvaluator().evaluate("ln(3.5)")));
+
+		(void)ee.evaluate("y = 1.0");
+		GATS_CHECK(ee.update() == 3);
+		GATS_CHECK(value_of<Real>(ee.watched(b)) == 2);
+
+		(void)ee.evaluate("z = 1");
+		GATS_CHECK(ee.update() == 0);
+	}
+
+	GATS_TEST_CASE(EE_watch_dirty_subtrees) {
+		Tokenizer tokenizer;
+		auto assign = [&](char const* expression) { (void)IncrementalProgram(Parser().compile(tokenizer.tokenize(expression))).evaluate(); };
+		assign("p = 1");
+		assign("q = 2.0");
+		IncrementalProgram program(Parser().compile(tokenizer.tokenize("sin(q) * cos(q) + p")));
+		GATS_CHECK(program.reads().size() == 2);
+		(void)program.evaluate();
+		GATS_CHECK(program.recomputed() == 4);
+		GATS_CHECK(!program.is_dirty());
+
+		assign("p = 2");
+		GATS_CHECK(program.is_dirty());
+		auto result = program.evaluate();
+		GATS_CHECK(program.recomputed() == 1);
+		GATS_CHECK(value_of<Real>(result) == value_of<Real>(ExpressionEvaluator().evaluate("sin(2.0) * cos(2.0) + 2")));
+	}
+
+	GATS_TEST_CASE(EE_watch_assignment) {
+		ExpressionEvaluator ee;
+		(void)ee.evaluate("k = 1");
+		(void)ee.watch("m = k + 1");
+		auto tenfold = ee.watch("m * 10");
+		GATS_CHECK(value_of<Integer>(ee.watched(tenfold)) == Integer::value_type("20"));
+		(void)ee.evaluate("k = 5");
+		GATS_CHECK(ee.update() == 2);
+		GATS_CHECK(value_of<Integer>(ee.watched(tenfold)) == Integer::value_type("60"));
+		GATS_CHECK(ee.update() == 0);
+	}
+#endif // TEST_WATCH
+
+
+
+#if TEST_FORMULA_GRAPH
+	GATS_TEST_CASE(EE_formula_graph) {
+		for (unsigned threads : { 1u, 4u }) {
+			FormulaGraph graph(threads);
+			(void)graph.define("a = b + c");
+			(void)graph.define("c = sin(d)");
+			(void)graph.define("b = 2");
+			(void)graph.define("d = 0.5");
+			(void)graph.define("t = a * 2");
+			GATS_CHECK(graph.levels().size() == 4);
+			GATS_CHECK(graph.recalculate() == 5);
+			GATS_CHECK(value_of<Real>(graph.value("t")) == value_of<Real>(ExpressionEvaluator().evaluate("(2 + sin(0.5)) * 2")));
+			GATS_CHECK(graph.recalculate() == 0);
+
+			(void)graph.define("b = 3");
+			GATS_CHECK(graph.recalculate() == 3);
+			GATS_CHECK(value_of<Real>(graph.value("t")) == value_of<Real>(ExpressionEvaluator().evaluate("(3 + sin(0.5)) * 2")));
+		}
+	}
+
+	GATS_TEST_CASE(EE_formula_graph_errors) {
+		FormulaGraph graph(2);
+		(void)graph.define("a = b + 1");
+		(void)graph.define("b = 2");
+		GATS_CHECK_THROW(graph.define("b = a * 2"), std::exception&);
+		GATS_CHECK_THROW(graph.define("f = f + 1"), std::exception&);
+		GATS_CHECK_THROW(graph.define("a + 1"), std::exception&);
+		GATS_CHECK(graph.size() == 2);
+		GATS_CHECK(graph.recalculate() == 2);
+		GATS_CHECK(value_of<Integer>(graph.value("a")) == Integer::value_type("3"));
+
+		(void)graph.define("h = 1 / 0");
+		GATS_CHECK_THROW(graph.recalculate(), std::exception&);
+		graph.remove("h");
+		GATS_CHECK(graph.recalculate() == 0);
+	}
+#endif // TEST_FORMULA_GRAPH
+
+
+
+#if TEST_SLOT_BINDING
+	GATS_TEST_CASE(EE_variable_slot_binding) {
+		ExpressionEvaluator ee;
+		(void)ee.evaluate("x = 1");
+		auto const x = ee.slot("x");
+		auto const y = ee.slot("y");
+		GATS_CHECK(y == x + 1);
+
+		Operand::pointer_type const row[] = { make_operand<Integer>(Integer::value_type(6)), make_operand<Integer>(Integer::value_type(7)) };
+		ee.context().bind(x, row);
+		auto result = ee.evaluate("x * y");
+		GATS_CHECK(value_of<Integer>(result) == Integer::value_type("42"));
+	}
+#endif // TEST_SLOT_BINDING
+
+
+
+#if TEST_SHARED_PROGRAM
+	GATS_TEST_CASE(EE_shared_program_contexts) {
+		ExpressionEvaluator ee;
+		auto const program = ee.compile("y = x * x + result(1)");
+		auto const x = ee.slot("x");
+		auto const y = ee.slot("y");
+
+		std::vector<Integer::value_type> values(4);
+		std::vector<std::thread> threads;
+		for (std::size_t t = 0; t < values.size(); ++t)
+			threads.emplace_back([&, t] {
+				RPNEvaluator rpn;
+				EvaluationContext context;
+				context.add_result(make_operand<Integer>(Integer::value_type(100)));
+				for (int i = 0; i <= 50; ++i) {
+					context.set(x, make_operand<Integer>(Integer::value_type(t * 1000 + i)));
+					(void)rpn.evaluate(program, context);
+				}
+				values[t] = value_of<Integer>(context.value(y));
+			});
+		for (auto& thread : threads)
+			thread.join();
+
+		for (std::size_t t = 0; t < values.size(); ++t) {
+			Integer::value_type const last(t * 1000 + 50);
+			GATS_CHECK(values[t] == last * last + 100);
+		}
+		GATS_CHECK(ee.context().value(y) == nullptr);
+		GATS_CHECK(ee.context().result_count() == 0);
+	}
+#endif // TEST_SHARED_PROGRAM
+
+
+
+#if TEST_RESULT_HISTORY
+	GATS_TEST_CASE(EE_result_history_ring) {
+		ExpressionEvaluator ee;
+		ee.context().results().set_depth(2);
+		for (auto expr : { "1", "2", "3" })
+			(void)ee.evaluate(expr);
+		GATS_CHECK(ee.context().result_count() == 3);
+		GATS_CHECK(value_of<Integer>(ee.evaluate("result(2) + result(3)")) == Integer::value_type("5"));
+		GATS_CHECK_THROW((void)ee.evaluate("result(1)"), std::exception&);
+	}
+
+	GATS_TEST_CASE(EE_result_history_spill) {
+		auto const path = std::filesystem::temp_directory_path() / "ee_result_history_spill.bin";
+		{
+			ExpressionEvaluator ee;
+			ee.context().results().set_depth(1);
+			ee.context().results().spill_to(path);
+			(void)ee.evaluate("-12345678901234567890");
+			(void)ee.evaluate("sqrt(2.0)");
+			(void)ee.evaluate("1 < 2");
+			(void)ee.evaluate("x = 4");
+			GATS_CHECK(value_of<Integer>(ee.evaluate("result(1)")) == Integer::value_type("-12345678901234567890"));
+			GATS_CHECK(value_of<Real>(ee.evaluate("result(2)")) == sqrt(Real::value_type("2.0")));
+			GATS_CHECK(value_of<Boolean>(ee.evaluate("result(3)")) == true);
+			GATS_CHECK(value_of<Integer>(ee.evaluate("result(4)")) == Integer::value_type("4"));
+			GATS_CHECK(std::filesystem::exists(path));
+		}
+		GATS_CHECK(!std::filesystem::exists(path));
+	}
+#endif // TEST_RESULT_HISTORY
+
+
+
+#if TEST_SERIALIZATION
+	GATS_TEST_CASE(EE_program_serialization) {
+		ExpressionEvaluator source;
+		std::ostringstream os(std::ios::binary);
+		source.save(source.compile("y = if(x > 1, x * 2.5, 12345678901234567890)"), os);
+		auto const bytes = os.str();
+
+		ExpressionEvaluator target;
+		(void)target.evaluate("other = 1");
+		auto const program = target.load(std::as_bytes(std::span(bytes.data(), bytes.size())));
+		(void)target.evaluate("x = 4");
+		RPNEvaluator rpn;
+		(void)rpn.evaluate(program, target.context());
+		GATS_CHECK(value_of<Real>(target.context().value(target.slot("y"))) == Real::value_type("10.0"));
+		(void)target.evaluate("x = 0");
+		(void)rpn.evaluate(program, target.context());
+		GATS_CHECK(value_of<Integer>(target.context().value(target.slot("y"))) == Integer::value_type("12345678901234567890"));
+
+		auto corrupt = bytes;
+		corrupt[0] = 'X';
+		GATS_CHECK_THROW((void)target.load(std::as_bytes(std::span(corrupt.data(), corrupt.size()))), std::exception&);
+		GATS_CHECK_THROW((void)target.load(std::as_bytes(std::span(bytes.data(), bytes.size() - 1))), std::exception&);
+
+		// a corrupt byte count of the 8-byte Integer 12345678901234567890 fails as truncated
+		auto const count = bytes.find(std::string("\x08\x00\x00\x00\xd2\x0a\x1f\xeb", 8));
+		GATS_CHECK(count != std::string::npos);
+		corrupt = bytes;
+		corrupt.replace(count, 4, "\xf0\xff\xff\xff", 4);
+		GATS_CHECK_THROW((void)target.load(std::as_bytes(std::span(corrupt.data(), corrupt.size()))), std::exception&);
+	}
+#endif // TEST_SERIALIZATION
+
+
+
+#if TEST_FORMULA_LIBRARY
+	GATS_TEST_CASE(EE_formula_library) {
+		auto const path = std::filesystem::temp_directory_path() / "ee_formula_library.eel";
+		{
+			ExpressionEvaluator source;
+			std::vector<std::pair<std::string, std::string>> formulas;
+			for (int i = 0; i < 100; ++i)
+				formulas.emplace_back("f" + std::to_string(i), "x * " + std::to_string(i) + " + 1");
+			formulas.emplace_back("half", "x / 2.0");
+			FormulaLibrary::write(path, source, formulas);
+			GATS_CHECK_THROW(FormulaLibrary::write(path, source, { { "a", "1" }, { "a", "2" } }), std::exception&);
+		}
+
+		FormulaLibrary library(path);
+		GATS_CHECK(library.size() == 101);
+		GATS_CHECK(library.contains("f42"));
+		GATS_CHECK(!library.contains("f100"));
+
+		ExpressionEvaluator target;
+		(void)target.evaluate("x = 3");
+		RPNEvaluator rpn;
+		GATS_CHECK(value_of<Integer>(rpn.evaluate(library.load("f42", target), target.context())) == Integer::value_type("127"));
+		GATS_CHECK(value_of<Real>(rpn.evaluate(library.load("half", target), target.context())) == Real::value_type("1.5"));
+		GATS_CHECK_THROW((void)library.load("g", target), std::exception&);
+	}
+#endif // TEST_FORMULA_LIBRARY
+
+
+
+#if TEST_JIT
+	GATS_TEST_CASE(EE_jit_program) {
+		ExpressionEvaluator ee;
+		auto const a = ee.slot("a");
+		auto const b = ee.slot("b");
+		JitProgram program(ee.compile("(a * b - 7) % (b + 3) + -a / 2"), 2);
+		RPNEvaluator rpn;
+		auto check = [&](char const* x, char const* y) {
+			EvaluationContext context;
+			context.set(a, std::static_pointer_cast<Operand>(ExpressionEvaluator().evaluate(x)));
+			context.set(b, std::static_pointer_cast<Operand>(ExpressionEvaluator().evaluate(y)));
+			auto const expected = rpn.evaluate(program.program(), context);
+			auto const actual = program.evaluate(context);
+			GATS_CHECK(actual->str() == expected->str());
+			GATS_CHECK(typeid(*actual) == typeid(*expected));
+		};
+		check("10", "4");
+		check("-10", "4");
+		GATS_CHECK(program.is_compiled() == JitProgram::is_supported());
+		check("123456789", "-987654321");
+		check("9223372036854775807", "2");			// overflows: interpreted
+		check("5", "2.5");							// real input: interpreted
+		check("99999999999999999999", "1");
+
+		EvaluationContext context;
+		context.set(a, make_operand<Integer>(1));
+		context.set(b, make_operand<Integer>(-3));
+		GATS_CHECK_THROW((void)program.evaluate(context), std::exception&);
+		GATS_CHECK(!JitProgram(ee.compile("a + 1.0"), 0).is_compiled());
+	}
+#endif // TEST_JIT
+
+
+
+#if TEST_STATIC_FORMULA
+	GATS_TEST_CASE(EE_static_formula) {
+		using Polynomial = StaticFormula<"-x ** 2 + 7 / -2 * x - x mod 3 + 123456789012345678901234567890">;
+		static_assert(Polynomial::arity == 1);
+		ExpressionEvaluator ee;
+		(void)ee.evaluate("x = 5");
+		GATS_CHECK(Polynomial::evaluate(Integer::value_type(5)) == value_of<Integer>(ee.evaluate("-x ** 2 + 7 / -2 * x - x mod 3 + 123456789012345678901234567890")));
+
+		using Mixed = StaticFormula<"(r + 1) * pi / 2.5 % 0.75">;
+		GATS_CHECK(Mixed::evaluate(Integer::value_type(2)) == value_of<Real>(ee.evaluate("(2 + 1) * pi / 2.5 % 0.75")));
+
+		using Native = StaticFormula<"(a * b - 7) % (b + 3) + a / 2.0", std::int64_t, double>;
+		static_assert(std::is_same_v<decltype(Native::evaluate(std::int64_t(1), std::int64_t(2))), double>);
+		GATS_CHECK(Native::name(0) == "a" && Native::name(1) == "b");
+		GATS_CHECK(Native::evaluate(std::int64_t(10), std::int64_t(4)) == (10 * 4 - 7) % (4 + 3) + 10 / 2.0);
+
+		GATS_CHECK_THROW((void)StaticFormula<"x % 0">::evaluate(Integer::value_type(1)), std::exception&);
+		GATS_CHECK_THROW((void)StaticFormula<"x ** 1000000">::evaluate(Integer::value_type(3)), std::exception&);
+		using NativePower = StaticFormula<"2 ** x", std::int64_t, double>;
+		using NativeSign = StaticFormula<"(-1) ** x", std::int64_t, double>;
+		GATS_CHECK_THROW((void)NativePower::evaluate(std::int64_t(1'000'001)), std::exception&);
+		GATS_CHECK(NativeSign::evaluate(std::int64_t(1'000'001)) == -1);
+
+		// identifiers are letters and digits, as for Tokenizer
+		GATS_CHECK_THROW((void)static_formula_detail::parse<4>("a_b"), std::exception&);
+		GATS_CHECK_THROW((void)ee.evaluate("a_b"), std::exception&);
+
+		// only Real literals exact in a double are accepted by a built-in REAL
+		bool exact = false;
+		for (char const* literal : { "0.5", "0.75", "2.0", "1250.0", "3.0e2", "0.000030517578125" }) {
+			(void)static_formula_detail::to_double(literal, exact);
+			GATS_CHECK_MESSAGE(exact, literal);
+		}
+		for (char const* literal : { "0.1", "2.3", "1.0e23", "9007199254740993.0", "0.0000000000000000000000000000001" }) {
+			(void)static_formula_detail::to_double(literal, exact);
+			GATS_CHECK_MESSAGE(!exact, literal);
+		}
+	}
+#endif // TEST_STATIC_FORMULA
+
+
+
+#if TEST_EMIT_CPP
+	GATS_TEST_CASE(EE_emit_cpp) {
+		ExpressionEvaluator ee;
+		auto emit = [&](char const* expression, CppNumbers numbers) {
+			std::ostringstream oss;
+			ee.emit_cpp(ee.compile(expression), "f", numbers, oss);
+			return oss.str();
+		};
+		auto const folded = emit("if(x > 2, (3 + 4) * x, y ** 2) + 1.5", CppNumbers::Multiprecision);
+		GATS_CHECK(folded.find("template <typename T0, typename T1>") != std::string::npos);
+		GATS_CHECK(folded.find("auto f(T0 const& x_, T1 const& y_)") != std::string::npos);
+		GATS_CHECK(folded.find("ee_mp::multiply(ee_mp::integer(7), x_)") != std::string::npos);
+		GATS_CHECK(folded.find("ee_mp::conditional(ee_mp::greater(x_, ee_mp::integer(2)), [&]") != std::string::npos);
+		GATS_CHECK(folded.find("static ee_mp::real const literal0(\"1.5\");") != std::string::npos);
+
+		GATS_CHECK(emit("not (1 < 2) or 2 ** 3 == 8", CppNumbers::Native).find("return true;") != std::string::npos);
+		GATS_CHECK(emit("1 / 0 + x", CppNumbers::Native).find("ee_native::divide(ee_native::integer(1), ee_native::integer(0))") != std::string::npos);
+
+		GATS_CHECK_THROW(emit("x = 1", CppNumbers::Multiprecision), std::exception&);
+		GATS_CHECK_THROW(emit("result(1)", CppNumbers::Multiprecision), std::exception&);
+		GATS_CHECK_THROW(emit("123456789012345678901234567890 + x", CppNumbers::Native), std::exception&);
+	}
+#endif // TEST_EMIT_CPP
+
+
+
+#if TEST_COLUMN_EVALUATOR
+	GATS_TEST_CASE(EE_column_evaluator) {
+		constexpr std::size_t rows = 150;		// two full words and a partial one
+		BooleanColumn a(rows), b(rows);
+		IntegerColumn x(rows);
+		RealColumn y(rows);
+		for (std::size_t i = 0; i < rows; ++i) {
+			a.set(i, i % 3 == 0);
+			b.set(i, i % 5 < 2);
+			x[i] = std::int64_t(i % 11) - 5;
+			y[i] = (i % 7) * 0.75 - 2.0;
+		}
+		ExpressionEvaluator ee;
+		ColumnEvaluator columns(rows);
+		columns.bind(ee.slot("a"), a);
+		columns.bind(ee.slot("b"), b);
+		columns.bind(ee.slot("x"), x);
+		columns.bind(ee.slot("y"), y);
+
+		for (char const* expression : { "a and not b or x > 3", "a xor b == (y <= -0.5)", "x != -2 nand a",
+				"a < b or (a >= b) xnor x == y", "(a > b) nor (x <= 0)", "true and y < x", "not (a <= false)" }) {
+			auto const program = ee.compile(expression);
+			auto const batch = columns.evaluate(program);
+			GATS_CHECK(batch.size() == rows);
+			RPNEvaluator rpn;
+			EvaluationContext context;
+			bool matches = true;
+			for (std::size_t i = 0; i < rows; ++i) {
+				context.set(ee.slot("a"), make_operand<Boolean>(a[i]));
+				context.set(ee.slot("b"), make_operand<Boolean>(b[i]));
+				context.set(ee.slot("x"), make_operand<Integer>(x[i]));
+				context.set(ee.slot("y"), make_operand<Real>(Real::value_type(y[i])));
+				matches = matches && value_of<Boolean>(rpn.evaluate(program, context)) == batch[i];
+			}
+			GATS_CHECK_MESSAGE(matches, expression);
+		}
+		GATS_CHECK((a & b).count() == 20);
+		GATS_CHECK((~a).count() == rows - a.count());
+
+		GATS_CHECK_THROW(columns.bind(ee.slot("z"), IntegerColumn(rows + 1)), std::exception&);
+		GATS_CHECK_THROW((void)columns.evaluate(ee.compile("a and z")), std::exception&);
+		GATS_CHECK_THROW((void)columns.evaluate(ee.compile("a and x")), std::exception&);
+		GATS_CHECK_THROW((void)columns.evaluate(ee.compile("x + 1 > 2")), std::exception&);
+		GATS_CHECK_THROW((void)columns.evaluate(ee.compile("x")), std::exception&);
+	}
+#endif // TEST_COLUMN_EVALUATOR
+
+
+
+#if TEST_COLUMN_FILTER
+	GATS_TEST_CASE(EE_column_filter) {
+		constexpr std::size_t rows = 150;
+		BooleanColumn a(rows);
+		IntegerColumn x(rows);
+		RealColumn y(rows);
+		for (std::size_t i = 0; i < rows; ++i) {
+			a.set(i, i % 3 == 0);
+			x[i] = std::int64_t(i % 11) - 5;
+			y[i] = (i % 7) * 0.75 - 2.0;
+		}
+		ExpressionEvaluator ee;
+		ColumnEvaluator columns(rows);
+		columns.bind(ee.slot("a"), a);
+		columns.bind(ee.slot("x"), x);
+		columns.bind(ee.slot("y"), y);
+
+		auto set_rows = [](BooleanColumn const& bits) {
+			Selection selected;
+			for (std::size_t i = 0; i < bits.size(); ++i)
+				if (bits[i])
+					selected.push_back(std::uint32_t(i));
+			return selected;
+		};
+
+		for (char const* expression : { "x > -2", "-3 <= y", "x != y", "a or x == 1", "2.5 > x and a" }) {
+			auto const program = ee.compile(expression);
+			auto const expected = set_rows(columns.evaluate(program));
+			GATS_CHECK_MESSAGE(columns.select(program) == expected, expression);
+
+			Selection odd;
+			for (std::uint32_t i = 1; i < rows; i += 2)
+				odd.push_back(i);
+			Selection oddExpected;
+			std::copy_if(expected.begin(), expected.end(), std::back_inserter(oddExpected), [](auto i) { return i % 2 == 1; });
+			GATS_CHECK_MESSAGE(columns.select(program, odd) == oddExpected, expression);
+		}
+		GATS_CHECK_THROW((void)columns.select(ee.compile("x > -2"), { 0, std::uint32_t(rows) }), std::exception&);
+		GATS_CHECK_THROW((void)columns.select(ee.compile("not a"), { std::uint32_t(-1) }), std::exception&);
+
+		for (char const* expression : { "x >= -4 and y < 1 and a", "a and (x > 0 or y > 0) and x != 3", "x == 100 and a", "not a" }) {
+			auto const program = ee.compile(expression);
+			auto const expected = set_rows(columns.evaluate(program));
+			ColumnFilter filter(program);
+			GATS_CHECK_MESSAGE(filter.select(columns) == expected, expression);
+			GATS_CHECK_MESSAGE(filter.select(columns) == expected, expression);
+		}
+		GATS_CHECK(ColumnFilter(ee.compile("x >= -4 and y < 1 and a")).predicates().size() == 3);
+		GATS_CHECK(ColumnFilter(ee.compile("if(a, x > 0, y > 0) and a")).predicates().size() == 1);
+
+		// the predicate keeping 1 row in 11 moves ahead of the one keeping 10 in 11
+		ColumnFilter filter(ee.compile("x >= -4 and x == 5"));
+		(void)filter.select(columns);
+		GATS_CHECK(filter.predicates().front().selectivity < 0.1);
+		GATS_CHECK(filter.predicates().back().selectivity > 0.9);
+	}
+#endif // TEST_COLUMN_FILTER
+
+
+
+#if TEST_STATS
+	GATS_TEST_CASE(EE_stats) {
+		ExpressionEvaluator ee;
+		GATS_CHECK(!ee.stats_enabled());
+		(void)ee.evaluate("x = 1");
+		GATS_CHECK(ee.stats().expressions() == 0);
+		GATS_CHECK(ee.stats()[Stage::Evaluate].runs == 0);
+
+		ee.enable_stats();
+		(void)ee.evaluate("1 + 2 * 3");
+		(void)ee.evaluate("x * 2");
+		auto const program = ee.compile("x + 1");
+		auto const& stats = ee.stats();
+		GATS_CHECK(stats.expressions() == 3);
+		GATS_CHECK(stats[Stage::Tokenize].runs == 3);
+		GATS_CHECK(stats[Stage::Parse].runs == 3);
+		GATS_CHECK(stats[Stage::Evaluate].runs == 2);
+		GATS_CHECK(stats.tokens() == 11);
+		GATS_CHECK(stats.program_tokens() == 11);
+		GATS_CHECK(stats.max_stack_depth() == 3);
+		GATS_CHECK(stats[Stage::Tokenize].allocations > 0);
+		GATS_CHECK(stats[Stage::Evaluate].allocations >= 3);
+		GATS_CHECK(stats[Stage::Evaluate].longest <= stats[Stage::Evaluate].total);
+		GATS_CHECK(stats[Stage::Evaluate].mean() <= stats[Stage::Evaluate].longest);
+
+		GATS_CHECK_THROW((void)ee.evaluate("1 +"), std::exception&);
+		GATS_CHECK(stats[Stage::Tokenize].runs == 4);
+		GATS_CHECK(stats[Stage::Parse].runs == 3);
+
+		ee.enable_stats(false);
+		(void)ee.evaluate("2 * 2");
+		GATS_CHECK(stats[Stage::Tokenize].runs == 4);
+		std::ostringstream table;
+		table << stats;
+		GATS_CHECK(table.str().find("evaluate") != std::string::npos);
+
+		ee.reset_stats();
+		GATS_CHECK(stats.expressions() == 0);
+		GATS_CHECK(stats[Stage::Parse].total == StageStats::duration{});
+	}
+#endif // TEST_STATS
+
+
+
+#if TEST_PROFILE
+	GATS_TEST_CASE(EE_profile) {
+		ExpressionEvaluator ee;
+		(void)ee.evaluate("x = 0.5");
+		std::string const expression = "2 * sin(x) + (x + 1) ** 3 * if(x > 0, cos(x), 1)";
+		auto const profile = ee.profile(expression, 3);
+		auto const& sites = profile.sites();
+		GATS_CHECK(ee.context().result_count() == 1);
+
+		auto site = [&](std::string const& source) {
+			auto found = std::find_if(sites.begin(), sites.end(), [&](auto const& s) { return s.source == source; });
+			return found == sites.end() ? nullptr : &*found;
+		};
+		GATS_CHECK(sites.back().source == expression && sites.back().operation == "Addition");
+		GATS_CHECK(sites.back().parent == Profile::NO_PARENT && sites.back().counter.calls == 3);
+
+		auto sine = site("sin(x)");
+		GATS_CHECK(sine && sine->operation == "Sin" && sine->counter.calls == 3);
+		auto power = site("(x + 1) ** 3");
+		GATS_CHECK(power && power->operation == "Power" && power->counter.calls == 3);
+		GATS_CHECK(power && site("x + 1") && sites[site("x + 1")->parent].operation == "Power");
+		auto conditional = site("if(x > 0, cos(x), 1)");
+		GATS_CHECK(conditional && conditional->operation == "If");
+		GATS_CHECK(site("cos(x)") && &sites[site("cos(x)")->parent] == conditional);
+		GATS_CHECK(site("x > 0") && &sites[site("x > 0")->parent] == conditional);
+
+		auto const operations = profile.by_operation();
+		GATS_CHECK(operations.at("Multiplication").calls == 6);
+		GATS_CHECK(operations.at("Cos").calls == 3);
+		GATS_CHECK(operations.at("Sin").time.count() > 0);
+
+		std::ostringstream folded;
+		profile.write_folded(folded);
+		GATS_CHECK(folded.str().find("Addition: " + expression + ";Multiplication: 2 * sin(x);Sin: sin(x) ") != std::string::npos);
+		GATS_CHECK(folded.str().find(";If: if(x > 0, cos(x), 1);Cos: cos(x) ") != std::string::npos);
+
+		// the branch not taken is not evaluated
+		auto const lazy = ee.profile("if(x < 0, sin(x), 2)");
+		GATS_CHECK(lazy.by_operation().at("Sin").calls == 0);
+		GATS_CHECK(lazy.by_operation().at("Less").calls == 1);
+	}
+#endif // TEST_PROFILE
+
+
+
+#if TEST_FACTORIAL
+	GATS_TEST_CASE(EE_factorial_table_boundary) {
+		GATS_CHECK(value_of<Integer>(ExpressionEvaluator().evaluate("20!")) == Integer::value_type("2432902008176640000"));
+		GATS_CHECK(value_of<Integer>(ExpressionEvaluator().evaluate("21!")) == Integer::value_type("51090942171709440000"));
+	}
+
+	GATS_TEST_CASE_SERIAL(EE_factorial_parallel) {
+		Integer::value_type product = 1;
+		for (unsigned i = 2; i <= 6000; ++i)
+			product *= i;
+		auto const threshold = Factorial::parallel_threshold.load();
+		Factorial::parallel_threshold = 1;
+		auto parallel = ExpressionEvaluator().evaluate("6000!");
+		Factorial::parallel_threshold = 0;
+		auto sequential = ExpressionEvaluator().evaluate("6000!");
+		Factorial::parallel_threshold = threshold;
+		GATS_CHECK(value_of<Integer>(parallel) == product);
+		GATS_CHECK(value_of<Integer>(sequential) == product);
+	}
+
+	GATS_TEST_CASE_SERIAL(EE_factorial_limit) {
+		auto const limit = Factorial::max_argument.load();
+		Factorial::max_argument = 50;
+		GATS_CHECK_THROW((void)ExpressionEvaluator().evaluate("51!"), std::exception&);
+		GATS_CHECK(value_of<Integer>(ExpressionEvaluator().evaluate("50!")) > 0);
+		Factorial::max_argument = limit;
+		GATS_CHECK_THROW((void)ExpressionEvaluator().evaluate("123456789012345678901234567890!"), std::exception&);
+	}
+#endif // TEST_FACTORIAL
+
+
+
+#if TEST_POWER
+	GATS_TEST_CASE(EE_power_operator_integer_fast_paths) {
+		GATS_CHECK(value_of<Integer>(ExpressionEvaluator().evaluate("2**100")) == Integer::value_type("1267650600228229401496703205376"));
+		GATS_CHECK(value_of<Integer>(ExpressionEvaluator().evaluate("2**3**4")) == Integer::value_type("2417851639229258349412352"));
+		GATS_CHECK(value_of<Integer>(ExpressionEvaluator().evaluate("0**0")) == Integer::value_type("1"));
+		GATS_CHECK(value_of<Integer>(ExpressionEvaluator().evaluate("1**123456789012345678901234567890")) == Integer::value_type("1"));
+		GATS_CHECK_THROW((void)ExpressionEvaluator().evaluate("3**123456789012345678901234567890"), std::exception&);
+	}
+
+	GATS_TEST_CASE(EE_power_operator_result_limit) {
+		GATS_CHECK(value_of<Integer>(ExpressionEvaluator().evaluate("2**999999")) == Integer::value_type(1) << 999999);
+		GATS_CHECK_THROW((void)ExpressionEvaluator().evaluate("2**4000000000"), std::exception&);
+		GATS_CHECK_THROW((void)ExpressionEvaluator().evaluate("(2**1024)**4000000000"), std::exception&);
+		GATS_CHECK_THROW((void)ExpressionEvaluator().evaluate("3**4000000000"), std::exception&);
+		GATS_CHECK_THROW((void)ExpressionEvaluator().evaluate("3**-4000000000"), std::exception&);
+	}
+
+	GATS_TEST_CASE(EE_power_operator_real_integer_exponent) {
+		auto result = ExpressionEvaluator().evaluate("2.5 ** 2");
+		GATS_CHECK(value_of<Real>(result) == Real::value_type("6.25"));
+		result = ExpressionEvaluator().evaluate("2 ** -2");
+		GATS_CHECK(value_of<Real>(result) == Real::value_type("0.25"));
+		GATS_CHECK_THROW((void)ExpressionEvaluator().evaluate("0 ** -1"), std::exception&);
+	}
+#endif // TEST_POWER
+
+
+
+#if TEST_TRANSCENDENTAL
+	GATS_TEST_CASE(EE_transcendental_accuracy) {
+		using boost::multiprecision::log;
+		Real::value_type const x("2.3"), small("0.7"), large("1000.5"), nearOne("1.0001");
+		GATS_CHECK(round(ExpressionEvaluator().evaluate("sin(2.3)")) == round(Real::value_type(sin(x))));
+		GATS_CHECK(round(ExpressionEvaluator().evaluate("sin(1000.5)")) == round(Real::value_type(sin(large))));
+		GATS_CHECK(round(ExpressionEvaluator().evaluate("cos(2.3)")) == round(Real::value_type(cos(x))));
+		GATS_CHECK(round(ExpressionEvaluator().evaluate("tan(2.3)")) == round(Real::value_type(tan(x))));
+		GATS_CHECK(round(ExpressionEvaluator().evaluate("arctan(2.3)")) == round(Real::value_type(atan(x))));
+		GATS_CHECK(round(ExpressionEvaluator().evaluate("arcsin(0.7)")) == round(Real::value_type(asin(small))));
+		GATS_CHECK(round(ExpressionEvaluator().evaluate("arccos(0.7)")) == round(Real::value_type(acos(small))));
+		GATS_CHECK(round(ExpressionEvaluator().evaluate("ln(2.3)")) == round(Real::value_type(log(x))));
+		GATS_CHECK(round(ExpressionEvaluator().evaluate("ln(1000.5)")) == round(Real::value_type(log(large))));
+		GATS_CHECK(round(ExpressionEvaluator().evaluate("ln(1.0001)")) == round(Real::value_type(log(nearOne))));
+		GATS_CHECK(round(ExpressionEvaluator().evaluate("log(2.3)")) == round(Real::value_type(log10(x))));
+		GATS_CHECK(round(ExpressionEvaluator().evaluate("lb(2.3)")) == round(Real::value_type(log(x) / log(Real::value_type(2)))));
+	}
+#endif // TEST_TRANSCENDENTAL
+
+
+
+#if TEST_FUNCTION_CACHE
+	GATS_TEST_CASE_SERIAL(EE_function_cache) {
+		auto const capacity = FunctionCache::capacity();
+		FunctionCache::clear();
+		FunctionCache::set_capacity(2);
+		auto first = ExpressionEvaluator().evaluate("ln(2)");
+		auto second = ExpressionEvaluator().evaluate("ln(2)");
+		GATS_CHECK(first.get() == second.get());
+		GATS_CHECK(FunctionCache::statistics().hits == 1);
+		GATS_CHECK(FunctionCache::statistics().misses == 1);
+
+		// same argument, different function and argument type
+		GATS_CHECK(value_of<Real>(ExpressionEvaluator().evaluate("sqrt(4)")) == 2);
+		GATS_CHECK(value_of<Real>(ExpressionEvaluator().evaluate("sqrt(4.0)")) == 2);
+		GATS_CHECK(FunctionCache::size() == 2);
+		GATS_CHECK(FunctionCache::statistics().evictions == 1);
+		GATS_CHECK(FunctionCache::statistics().hit_rate() == 0.25);
+
+		FunctionCache::set_capacity(0);
+		GATS_CHECK(FunctionCache::size() == 0);
+		auto uncached = ExpressionEvaluator().evaluate("ln(2)");
+		GATS_CHECK(uncached.get() != first.get());
+		GATS_CHECK(value_of<Real>(uncached) == value_of<Real>(first));
+		GATS_CHECK(FunctionCache::statistics().misses == 3);
+		FunctionCache::clear();
+		FunctionCache::set_capacity(capacity);
+	}
+
+	GATS_TEST_CASE_SERIAL(express_result_not_cached) {
+		auto const capacity = FunctionCache::capacity();
+		FunctionCache::set_capacity(16);
+		ExpressionEvaluator first, second;
+		(void)first.evaluate("1+1");
+		(void)second.evaluate("3+3");
+		GATS_CHECK(value_of<Integer>(first.evaluate("result(1)")) == Integer::value_type("2"));
+		GATS_CHECK(value_of<Integer>(second.evaluate("result(1)")) == Integer::value_type("6"));
+		FunctionCache::clear();
+		FunctionCache::set_capacity(capacity);
+	}
+#endif // TEST_FUNCTION_CACHE
+
+
+
+#if TEST_BENCHMARK
+	GATS_BENCH_CASE(EE_bench_evaluate_mixed, 200) {
+		static ExpressionEvaluator ee;
+		gats::do_not_optimize(ee.evaluate("(1 + 2.5) * 3 - 4 / 2.0 + 7 % 3"));
+	}
+
+	GATS_BENCH_CASE(EE_bench_compile_mixed, 200) {
+		gats::do_not_optimize(Parser().compile(Tokenizer().tokenize("(1 + 2.5) * 3 - 4 / 2.0 + 7 % 3")));
+	}
+
+	GATS_BENCH_CASE(EE_bench_rpn_program, 200) {
+		static ExpressionEvaluator ee;
+		static auto const program = ee.compile("y = x * x + 2 * x + 1");
+		static RPNEvaluator rpn;
+		static EvaluationContext context;
+		static auto const x = ee.slot("x");
+		context.set(x, make_operand<Integer>(Integer::value_type(12345)));
+		gats::do_not_optimize(rpn.evaluate(program, context));
+	}
+#endif // TEST_BENCHMARK
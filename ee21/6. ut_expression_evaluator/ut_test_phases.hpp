@@ -35,4 +35,24 @@
 #define TEST_VARIABLE false
 #define TEST_RESULT false
 
-
+#define TEST_CONDITIONAL true
+#define TEST_WATCH true
+#define TEST_FORMULA_GRAPH true
+#define TEST_SLOT_BINDING true
+#define TEST_SHARED_PROGRAM true
+#define TEST_RESULT_HISTORY true
+#define TEST_SERIALIZATION true
+#define TEST_FORMULA_LIBRARY true
+#define TEST_JIT true
+#define TEST_STATIC_FORMULA true
+#define TEST_EMIT_CPP true
+#define TEST_COLUMN_EVALUATOR true
+#define TEST_COLUMN_FILTER true
+#define TEST_STATS true
+#define TEST_PROFILE true
+#define TEST_FACTORIAL true
+#define TEST_POWER true
+#define TEST_TRANSCENDENTAL true
+#define TEST_FUNCTION_CACHE true
+
+#define TEST_BENCHMARK false
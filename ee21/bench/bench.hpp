@@ -0,0 +1,189 @@
+#pragma once
+/*! \file	bench.hpp
+	\brief	Expression Evaluator micro-benchmark framework.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Micro-benchmark framework declarations.
+	bench::State
+	bench::Case
+	bench::FunctionCase
+	bench::register_case()
+	bench::do_not_optimize()
+	BENCH_CASE()
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Added State::set_label().
+	Added State::reset_timer().
+	State reports allocations and bytes allocated per operation.
+	Added FunctionCase and register_case().
+	State reports the process CPU time per operation.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace bench {
+
+	/*! Heap allocations made by the process, counted by the replacement operator new of bench_main.cpp. */
+	inline std::atomic<std::uintmax_t> allocations_g{ 0 };
+	inline std::atomic<std::uintmax_t> allocatedBytes_g{ 0 };
+
+	/*! CPU time used so far by the process (every thread), from bench_main.cpp. */
+	[[nodiscard]] std::chrono::nanoseconds process_cpu_time();
+
+
+
+	/*!	\brief class State
+
+		Iteration control handed to a benchmark case.  The case body loops on keep_running(),
+		which grows the batch size until a batch takes at least 'minimum_time'. */
+	class State {
+	public:
+		using clock_type = std::chrono::steady_clock;
+		static constexpr std::chrono::milliseconds minimum_time{ 200 };
+	private:
+		std::uintmax_t			batch_m = 1;
+		std::uintmax_t			remaining_m = 1;
+		clock_type::time_point	start_m = clock_type::now();
+		std::chrono::nanoseconds	cpuStart_m = process_cpu_time();
+		double					nsPerOp_m = 0.0;
+		double					cpuNsPerOp_m = 0.0;
+		std::uintmax_t			iterations_m = 0;
+		std::string				label_m;
+		std::uintmax_t			allocations_m = allocations_g;		// counters at the start of the batch
+		std::uintmax_t			allocatedBytes_m = allocatedBytes_g;
+		double					allocsPerOp_m = 0.0;
+		double					bytesPerOp_m = 0.0;
+
+		void start_batch() {
+			allocations_m = allocations_g;
+			allocatedBytes_m = allocatedBytes_g;
+			cpuStart_m = process_cpu_time();
+			start_m = clock_type::now();
+		}
+	public:
+		/*! Returns true while more iterations are required. */
+		bool keep_running() {
+			if (remaining_m-- > 0)
+				return true;
+			auto elapsed = clock_type::now() - start_m;
+			auto cpu = process_cpu_time() - cpuStart_m;
+			if (elapsed < minimum_time && batch_m < (std::uintmax_t(1) << 40)) {
+				batch_m *= 2;
+				remaining_m = batch_m - 1;
+				start_batch();
+				return true;
+			}
+			iterations_m = batch_m;
+			nsPerOp_m = std::chrono::duration<double, std::nano>(elapsed).count() / batch_m;
+			cpuNsPerOp_m = std::chrono::duration<double, std::nano>(cpu).count() / batch_m;
+			allocsPerOp_m = double(allocations_g - allocations_m) / batch_m;
+			bytesPerOp_m = double(allocatedBytes_g - allocatedBytes_m) / batch_m;
+			return false;
+		}
+
+		/*! Restarts the clock and the allocation counts, so set-up done before the first keep_running() is not measured. */
+		void reset_timer() { start_batch(); }
+
+		[[nodiscard]] double			ns_per_op() const { return nsPerOp_m; }
+		[[nodiscard]] double			cpu_ns_per_op() const { return cpuNsPerOp_m; }
+		[[nodiscard]] std::uintmax_t	iterations() const { return iterations_m; }
+		[[nodiscard]] double			allocs_per_op() const { return allocsPerOp_m; }
+		[[nodiscard]] double			bytes_per_op() const { return bytesPerOp_m; }
+
+		/*! Free-form text reported next to the timing, e.g. the accuracy of the result. */
+		void set_label(std::string const& label) { label_m = label; }
+		[[nodiscard]] std::string const& label() const { return label_m; }
+	};
+
+
+
+	/*!	\brief class Case
+
+		Base type of the classes generated by BENCH_CASE().  Cases register themselves on construction. */
+	class Case {
+		std::string	name_m;
+	public:
+		Case(Case const&) = delete;
+		void operator = (Case const&) = delete;
+
+		explicit Case(std::string const& name) : name_m(name) { registry().push_back(this); }
+		virtual ~Case() = default;
+		virtual void execute(State& state) = 0;
+
+		[[nodiscard]] std::string const& name() const { return name_m; }
+
+		/*! All registered cases, in registration order. */
+		static std::vector<Case*>& registry() {
+			static std::vector<Case*> cases;
+			return cases;
+		}
+	};
+
+
+
+	/*!	\brief class FunctionCase
+
+		A case whose body is a function object, for families of cases generated at start-up. */
+	class FunctionCase : public Case {
+		std::function<void(State&)>	body_m;
+	public:
+		FunctionCase(std::string const& name, std::function<void(State&)> body) : Case(name), body_m(std::move(body)) { }
+		virtual void execute(State& state) override { body_m(state); }
+	};
+
+	/*! Registers the case 'name', running 'body'. */
+	inline void register_case(std::string const& name, std::function<void(State&)> body) {
+		static std::deque<FunctionCase> cases;
+		cases.emplace_back(name, std::move(body));
+	}
+
+
+
+	/*! Keeps the optimizer from discarding a value computed by a benchmark. */
+	template <typename T>
+	inline void do_not_optimize(T const& value) {
+		[[maybe_unused]] static T const* volatile sink;
+		sink = &value;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+	}
+
+} // end-of-namespace bench
+
+
+
+/*!	Creates a benchmark case with the identifier 'name'.
+	The body receives 'state' and must loop on state.keep_running(). */
+#define BENCH_CASE(name) \
+	static class BenchCase_ ## name : public bench::Case {\
+	public: BenchCase_ ## name() : Case(#name) { }\
+	public: virtual void execute(bench::State& state) override;\
+	} BenchCase_ ## name ## _g;\
+	void BenchCase_ ## name :: execute([[maybe_unused]] bench::State& state)
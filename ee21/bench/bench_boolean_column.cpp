@@ -0,0 +1,101 @@
+/*!	\file	bench_boolean_column.cpp
+	\brief	Column evaluation benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A rule over Boolean and numeric variables evaluated for every row
+of a batch: one interpreter evaluation per row versus one
+ColumnEvaluator evaluation of the whole batch of a million rows,
+whose label gives its time per row.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/boolean.hpp>
+#include <ee/column_evaluator.hpp>
+#include <ee/expression_evaluator.hpp>
+#include <ee/integer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace std;
+
+
+
+namespace {
+	char const columnRule[] = "a and not b or c xor d == (x > 3)";
+	constexpr size_t columnRows = 1'000'000;
+
+	/*! The value of the rule's variables in 'row'. */
+	bool column_a(size_t row) { return row % 3 == 0; }
+	bool column_b(size_t row) { return row % 5 < 2; }
+	bool column_c(size_t row) { return row % 7 == 1; }
+	bool column_d(size_t row) { return (row / 64) % 2 == 0; }
+	int64_t column_x(size_t row) { return int64_t(row % 11); }
+}
+
+
+
+BENCH_CASE(column_rule_interpreted) {
+	ExpressionEvaluator evaluator;
+	auto const program = evaluator.compile(columnRule);
+	auto& context = evaluator.context();
+	RPNEvaluator rpn;
+	size_t row = 0;
+	state.set_label("per row");
+	while (state.keep_running()) {
+		context.set(evaluator.slot("a"), make_operand<Boolean>(column_a(row)));
+		context.set(evaluator.slot("b"), make_operand<Boolean>(column_b(row)));
+		context.set(evaluator.slot("c"), make_operand<Boolean>(column_c(row)));
+		context.set(evaluator.slot("d"), make_operand<Boolean>(column_d(row)));
+		context.set(evaluator.slot("x"), make_operand<Integer>(column_x(row)));
+		bench::do_not_optimize(rpn.evaluate(program, context));
+		row = (row + 1) % columnRows;
+	}
+}
+
+BENCH_CASE(column_rule_batch) {
+	ExpressionEvaluator evaluator;
+	auto const program = evaluator.compile(columnRule);
+	ColumnEvaluator columns(columnRows);
+	BooleanColumn a(columnRows), b(columnRows), c(columnRows), d(columnRows);
+	IntegerColumn x(columnRows);
+	for (size_t row = 0; row < columnRows; ++row) {
+		a.set(row, column_a(row));
+		b.set(row, column_b(row));
+		c.set(row, column_c(row));
+		d.set(row, column_d(row));
+		x[row] = column_x(row);
+	}
+	columns.bind(evaluator.slot("a"), a);
+	columns.bind(evaluator.slot("b"), b);
+	columns.bind(evaluator.slot("c"), c);
+	columns.bind(evaluator.slot("d"), d);
+	columns.bind(evaluator.slot("x"), x);
+
+	state.reset_timer();
+	while (state.keep_running())
+		bench::do_not_optimize(columns.evaluate(program));
+	state.set_label(to_string(state.ns_per_op() / columnRows) + " ns/row");
+}
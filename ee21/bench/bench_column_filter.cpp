@@ -0,0 +1,90 @@
+/*!	\file	bench_column_filter.cpp
+	\brief	Selection vector filtering benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A conjunction of three comparisons, written with its most
+selective predicate last, filtered over a million rows: the whole
+conjunction evaluated to bits and the true rows extracted, versus
+a ColumnFilter that evaluates each predicate on the rows surviving
+the earlier ones and has moved the selective one first.  The
+labels give the time per row.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/column_evaluator.hpp>
+#include <ee/column_filter.hpp>
+#include <ee/expression_evaluator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace std;
+
+
+
+namespace {
+	char const filterRule[] = "p < 0.9 and q >= 10 and k == 7";		// keeps 90%, 90%, then 1% of the rows
+	constexpr size_t filterRows = 1'000'000;
+
+	/*! Binds the rule's columns to 'columns'. */
+	void bind_filter_columns(ExpressionEvaluator& evaluator, ColumnEvaluator& columns) {
+		RealColumn p(filterRows);
+		IntegerColumn q(filterRows), k(filterRows);
+		for (size_t row = 0; row < filterRows; ++row) {
+			p[row] = double(row * 7919 % 1000) / 1000.0;
+			q[row] = int64_t(row * 104729 % 100);
+			k[row] = int64_t(row * 31 % 100);
+		}
+		columns.bind(evaluator.slot("p"), move(p));
+		columns.bind(evaluator.slot("q"), move(q));
+		columns.bind(evaluator.slot("k"), move(k));
+	}
+}
+
+
+
+BENCH_CASE(column_filter_dense) {
+	ExpressionEvaluator evaluator;
+	auto const program = evaluator.compile(filterRule);
+	ColumnEvaluator columns(filterRows);
+	bind_filter_columns(evaluator, columns);
+
+	state.reset_timer();
+	while (state.keep_running())
+		bench::do_not_optimize(columns.select(program));
+	state.set_label(to_string(state.ns_per_op() / filterRows) + " ns/row");
+}
+
+BENCH_CASE(column_filter_selection) {
+	ExpressionEvaluator evaluator;
+	ColumnFilter filter(evaluator.compile(filterRule));
+	ColumnEvaluator columns(filterRows);
+	bind_filter_columns(evaluator, columns);
+
+	state.reset_timer();
+	while (state.keep_running())
+		bench::do_not_optimize(filter.select(columns));
+	state.set_label(to_string(state.ns_per_op() / filterRows) + " ns/row");
+}
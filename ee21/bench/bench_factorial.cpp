@@ -0,0 +1,69 @@
+/*!	\file	bench_factorial.cpp
+	\brief	Factorial benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Benchmarks of the Factorial operator at n = 20 (table lookup),
+n = 1000 (binary splitting), and n = 100000 with and without
+threaded partial products.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/integer.hpp>
+#include <ee/operator.hpp>
+
+#include <cstdint>
+
+using namespace std;
+
+
+
+namespace {
+	void factorial(bench::State& state, uint64_t n, uint64_t parallelThreshold = Factorial::parallel_threshold.load()) {
+		auto const threshold = Factorial::parallel_threshold.exchange(parallelThreshold);
+		Operand::pointer_type const argument = make_operand<Integer>(Integer::value_type(n));
+		Factorial const op;
+		while (state.keep_running())
+			bench::do_not_optimize(op.perform(ArgumentList(&argument, 1)));
+		Factorial::parallel_threshold = threshold;
+	}
+}
+
+
+
+BENCH_CASE(factorial_20) {
+	factorial(state, 20);
+}
+
+BENCH_CASE(factorial_1000) {
+	factorial(state, 1'000);
+}
+
+BENCH_CASE(factorial_100000_sequential) {
+	factorial(state, 100'000, 0);
+}
+
+BENCH_CASE(factorial_100000_parallel) {
+	factorial(state, 100'000, 1);
+}
@@ -0,0 +1,75 @@
+/*!	\file	bench_formula_graph.cpp
+	\brief	FormulaGraph benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A pricing-sheet shaped graph: one input, 64 independent
+formulas that read it, and a total over them.  Each iteration
+changes the input and recalculates, serially and on a pool of
+hardware_concurrency() threads.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/formula_graph.hpp>
+
+#include <string>
+#include <thread>
+
+using namespace std;
+
+
+
+namespace {
+	constexpr unsigned SHEET_FORMULAS = 64;
+
+	void recalculate_sheet(bench::State& state, unsigned threads) {
+		FormulaGraph sheet(threads);
+		(void)sheet.define("x = 0.5");
+		string total = "total = 0";
+		for (unsigned i = 0; i < SHEET_FORMULAS; ++i) {
+			auto const name = "f" + to_string(i);
+			(void)sheet.define(name + " = sin(x) * " + to_string(i) + " + ln(x + " + to_string(i + 1) + ")");
+			total += " + " + name;
+		}
+		(void)sheet.define(total);
+		(void)sheet.recalculate();
+
+		unsigned n = 0;
+		while (state.keep_running()) {
+			(void)sheet.define("x = " + to_string(++n % 100) + ".5");
+			bench::do_not_optimize(sheet.recalculate());
+		}
+		state.set_label(to_string(threads) + " thread(s)");
+	}
+}
+
+
+
+BENCH_CASE(formula_graph_serial) {
+	recalculate_sheet(state, 1);
+}
+
+BENCH_CASE(formula_graph_parallel) {
+	recalculate_sheet(state, std::thread::hardware_concurrency());
+}
@@ -0,0 +1,96 @@
+/*!	\file	bench_formula_library.cpp
+	\brief	Formula library benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Startup cost of a service that needs one formula out of a
+library of 10,000 or 100,000: mapping the precompiled library
+and loading the formula, versus compiling every formula from
+source.  Mapping should not grow with the size of the library.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/expression_evaluator.hpp>
+#include <ee/formula_library.hpp>
+#include <ee/RPNEvaluator.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+
+
+namespace {
+	[[nodiscard]] vector<pair<string, string>> library_formulas(size_t count) {
+		vector<pair<string, string>> formulas;
+		formulas.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+			formulas.emplace_back("formula" + to_string(i), "principal * (1.0 + rate) ** " + to_string(i % 40) + " + " + to_string(i));
+		return formulas;
+	}
+
+	/*! Times opening a library of 'count' formulas and evaluating the last one. */
+	void library_startup(bench::State& state, size_t count) {
+		auto const path = filesystem::temp_directory_path() / ("bench_formula_library_" + to_string(count) + ".eel");
+		{
+			ExpressionEvaluator evaluator;
+			FormulaLibrary::write(path, evaluator, library_formulas(count));
+		}
+		auto const name = "formula" + to_string(count - 1);
+		state.set_label(to_string(filesystem::file_size(path) / 1024) + " KiB");
+		state.reset_timer();
+		while (state.keep_running()) {
+			ExpressionEvaluator evaluator;
+			(void)evaluator.evaluate("principal = 1000");
+			(void)evaluator.evaluate("rate = 0.05");
+			FormulaLibrary library(path);
+			bench::do_not_optimize(RPNEvaluator().evaluate(library.load(name, evaluator), evaluator.context()));
+		}
+		filesystem::remove(path);
+	}
+}
+
+
+
+BENCH_CASE(formula_library_startup_10k) {
+	library_startup(state, 10'000);
+}
+
+BENCH_CASE(formula_library_startup_100k) {
+	library_startup(state, 100'000);
+}
+
+BENCH_CASE(formula_library_compile_sources_10k) {
+	auto const formulas = library_formulas(10'000);
+	state.reset_timer();
+	while (state.keep_running()) {
+		ExpressionEvaluator evaluator;
+		for (auto const& formula : formulas)
+			bench::do_not_optimize(evaluator.compile(formula.second));
+	}
+}
@@ -0,0 +1,74 @@
+/*!	\file	bench_function_cache.cpp
+	\brief	FunctionCache benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Repeated pure function calls evaluated with the FunctionCache
+disabled and enabled.  Cached cases report the hit rate.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/expression_evaluator.hpp>
+#include <ee/function.hpp>
+
+#include <string>
+
+using namespace std;
+
+
+
+namespace {
+	void evaluate_with_cache(bench::State& state, ExpressionEvaluator::expression_type const& expression, size_t capacity) {
+		auto const previous = FunctionCache::capacity();
+		FunctionCache::clear();
+		FunctionCache::set_capacity(capacity);
+
+		ExpressionEvaluator evaluator;
+		while (state.keep_running())
+			bench::do_not_optimize(evaluator.evaluate(expression));
+
+		if (capacity > 0)
+			state.set_label("hit rate " + to_string(int(FunctionCache::statistics().hit_rate() * 100)) + "%");
+		FunctionCache::clear();
+		FunctionCache::set_capacity(previous);
+	}
+}
+
+
+
+BENCH_CASE(function_cache_off_ln) {
+	evaluate_with_cache(state, "ln(2)", 0);
+}
+
+BENCH_CASE(function_cache_on_ln) {
+	evaluate_with_cache(state, "ln(2)", 1024);
+}
+
+BENCH_CASE(function_cache_off_rule) {
+	evaluate_with_cache(state, "sqrt(3) * sin(pi/6) + ln(2)", 0);
+}
+
+BENCH_CASE(function_cache_on_rule) {
+	evaluate_with_cache(state, "sqrt(3) * sin(pi/6) + ln(2)", 1024);
+}
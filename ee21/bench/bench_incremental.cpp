@@ -0,0 +1,81 @@
+/*!	\file	bench_incremental.cpp
+	\brief	Incremental re-evaluation benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A dashboard of 200 expressions over 20 shared variables, after
+one variable changes: re-evaluating every expression versus
+ExpressionEvaluator::update().
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/expression_evaluator.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+
+
+namespace {
+	constexpr unsigned DASHBOARD_VARIABLES = 20;
+	constexpr unsigned DASHBOARD_EXPRESSIONS = 200;
+
+	/*! Expression i reads v(i % 20) and v((i + 1) % 20), so each variable has 20 dependents. */
+	vector<string> dashboard(ExpressionEvaluator& evaluator) {
+		for (unsigned i = 0; i < DASHBOARD_VARIABLES; ++i)
+			(void)evaluator.evaluate("v" + to_string(i) + " = " + to_string(i + 1) + ".5");
+		vector<string> expressions;
+		for (unsigned i = 0; i < DASHBOARD_EXPRESSIONS; ++i)
+			expressions.push_back("sqrt(v" + to_string(i % DASHBOARD_VARIABLES) + ") * " + to_string(i) + " + v" + to_string((i + 1) % DASHBOARD_VARIABLES));
+		return expressions;
+	}
+}
+
+
+
+BENCH_CASE(incremental_dashboard_full) {
+	ExpressionEvaluator evaluator;
+	auto const expressions = dashboard(evaluator);
+	unsigned n = 0;
+	while (state.keep_running()) {
+		(void)evaluator.evaluate("v0 = " + to_string(++n % 100));
+		for (auto const& expression : expressions)
+			bench::do_not_optimize(evaluator.evaluate(expression));
+	}
+}
+
+BENCH_CASE(incremental_dashboard_update) {
+	ExpressionEvaluator evaluator;
+	for (auto const& expression : dashboard(evaluator))
+		(void)evaluator.watch(expression);
+	unsigned n = 0;
+	size_t recomputed = 0;
+	while (state.keep_running()) {
+		(void)evaluator.evaluate("v0 = " + to_string(++n % 100));
+		recomputed = evaluator.update();
+	}
+	state.set_label(to_string(recomputed) + " of " + to_string(DASHBOARD_EXPRESSIONS) + " re-evaluated");
+}
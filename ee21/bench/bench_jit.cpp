@@ -0,0 +1,70 @@
+/*!	\file	bench_jit.cpp
+	\brief	JIT program benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A hot integer formula evaluated by the interpreter versus the
+same formula promoted to native code by JitProgram.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/expression_evaluator.hpp>
+#include <ee/integer.hpp>
+#include <ee/jit_program.hpp>
+
+#include <cstdint>
+
+using namespace std;
+
+
+
+namespace {
+	char const jitFormula[] = "(price * quantity - discount) % 1000003 + quantity / 3";
+
+	/*! Binds the formula's variables in 'evaluator's context. */
+	void jit_inputs(ExpressionEvaluator& evaluator) {
+		evaluator.context().set(evaluator.slot("price"), make_operand<Integer>(1999));
+		evaluator.context().set(evaluator.slot("quantity"), make_operand<Integer>(48));
+		evaluator.context().set(evaluator.slot("discount"), make_operand<Integer>(250));
+	}
+}
+
+
+
+BENCH_CASE(jit_interpreted) {
+	ExpressionEvaluator evaluator;
+	jit_inputs(evaluator);
+	JitProgram program(evaluator.compile(jitFormula), UINT64_MAX);
+	while (state.keep_running())
+		bench::do_not_optimize(program.evaluate(evaluator.context()));
+}
+
+BENCH_CASE(jit_native) {
+	ExpressionEvaluator evaluator;
+	jit_inputs(evaluator);
+	JitProgram program(evaluator.compile(jitFormula), 0);
+	state.set_label(program.is_compiled() ? "native" : "interpreted");
+	while (state.keep_running())
+		bench::do_not_optimize(program.evaluate(evaluator.context()));
+}
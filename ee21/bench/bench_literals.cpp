@@ -0,0 +1,110 @@
+/*!	\file	bench_literals.cpp
+	\brief	Number literal tokenizing benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Benchmarks of Tokenizer::_get_number() over literal-heavy
+expressions: short and long integers, short, whole-valued, and
+long reals, scientific notation, hexadecimal, and binary.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Added scientific notation, hexadecimal, and binary cases.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/tokenizer.hpp>
+
+#include <string>
+
+using namespace std;
+
+
+
+namespace {
+	/*! Repeats 'literal' separated by '+' until the expression holds 'count' literals. */
+	Tokenizer::string_type literal_sum(Tokenizer::string_type const& literal, unsigned count = 16) {
+		Tokenizer::string_type expression(literal);
+		for (unsigned i = 1; i < count; ++i)
+			expression += "+" + literal;
+		return expression;
+	}
+
+	void tokenize(bench::State& state, Tokenizer::string_type const& expression) {
+		Tokenizer tokenizer;
+		while (state.keep_running())
+			bench::do_not_optimize(tokenizer.tokenize(expression));
+	}
+}
+
+
+
+BENCH_CASE(literal_integer_short) {
+	tokenize(state, literal_sum("12345"));
+}
+
+BENCH_CASE(literal_integer_19_digits) {
+	tokenize(state, literal_sum("1234567890123456789"));
+}
+
+BENCH_CASE(literal_integer_60_digits) {
+	tokenize(state, literal_sum("123456789012345678901234567890123456789012345678901234567890"));
+}
+
+BENCH_CASE(literal_real_short) {
+	tokenize(state, literal_sum("3.14159"));
+}
+
+BENCH_CASE(literal_real_whole_valued) {
+	tokenize(state, literal_sum("42.0"));
+}
+
+BENCH_CASE(literal_real_long) {
+	tokenize(state, literal_sum("3.14159265358979323846264338327950288419716939937510"));
+}
+
+BENCH_CASE(literal_real_scientific) {
+	tokenize(state, literal_sum("1.5e-9"));
+}
+
+BENCH_CASE(literal_real_scientific_whole_valued) {
+	tokenize(state, literal_sum("2.5E+6"));
+}
+
+BENCH_CASE(literal_real_scientific_expanded) {
+	tokenize(state, literal_sum("0.0000000015"));
+}
+
+BENCH_CASE(literal_hex_short) {
+	tokenize(state, literal_sum("0xFF"));
+}
+
+BENCH_CASE(literal_hex_128_bit) {
+	tokenize(state, literal_sum("0x123456789abcdef0123456789abcdef0"));
+}
+
+BENCH_CASE(literal_binary_short) {
+	tokenize(state, literal_sum("0b1010"));
+}
+
+BENCH_CASE(literal_binary_64_bit) {
+	tokenize(state, literal_sum("0b1010101010101010101010101010101010101010101010101010101010101010"));
+}
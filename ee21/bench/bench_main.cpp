@@ -0,0 +1,230 @@
+/*! \file	bench_main.cpp
+	\brief	Expression Evaluator micro-benchmark application.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Runs every registered BENCH_CASE() and reports the time, allocations and
+bytes allocated per operation.  Command-line arguments are substrings;
+when present only the cases whose names contain one of them are run.
+With --json the results are written to standard output as JSON, in the
+layout of Google Benchmark's JSON reporter, for regression tracking; its
+compare.py reads the file.  real_time is wall-clock time per operation
+and cpu_time the CPU time of the whole process per operation.
+
+The replacement operator new below (with its aligned overloads) counts
+every heap allocation.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Prints the case label.
+	Counts allocations; added --json.
+	Reports CPU time, the date and the CPU count; counts aligned allocations.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include <gats/ConsoleApp.hpp>
+#include "bench.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#include <malloc.h>
+#else
+#include <time.h>
+#endif
+
+using namespace std;
+
+
+
+void* operator new(size_t size) {
+	bench::allocations_g.fetch_add(1, memory_order_relaxed);
+	bench::allocatedBytes_g.fetch_add(size, memory_order_relaxed);
+	if (void* memory = malloc(size == 0 ? 1 : size))
+		return memory;
+	throw bad_alloc();
+}
+
+void operator delete(void* memory) noexcept { free(memory); }
+void operator delete(void* memory, size_t) noexcept { free(memory); }
+
+void* operator new(size_t size, align_val_t alignment) {
+	bench::allocations_g.fetch_add(1, memory_order_relaxed);
+	bench::allocatedBytes_g.fetch_add(size, memory_order_relaxed);
+	auto const align = static_cast<size_t>(alignment);
+#if defined(_WIN32)
+	if (void* memory = _aligned_malloc(size == 0 ? 1 : size, align))
+		return memory;
+#else
+	// aligned_alloc() needs a size that is a multiple of the alignment
+	if (void* memory = aligned_alloc(align, (size + align - 1) / align * align + (size == 0 ? align : 0)))
+		return memory;
+#endif
+	throw bad_alloc();
+}
+
+#if defined(_WIN32)
+void operator delete(void* memory, align_val_t) noexcept { _aligned_free(memory); }
+void operator delete(void* memory, size_t, align_val_t) noexcept { _aligned_free(memory); }
+#else
+void operator delete(void* memory, align_val_t) noexcept { free(memory); }
+void operator delete(void* memory, size_t, align_val_t) noexcept { free(memory); }
+#endif
+
+[[nodiscard]] chrono::nanoseconds bench::process_cpu_time() {
+#if defined(_WIN32)
+	FILETIME creation, exited, kernel, user;
+	if (!GetProcessTimes(GetCurrentProcess(), &creation, &exited, &kernel, &user))
+		return chrono::nanoseconds(0);
+	auto ticks = [](FILETIME const& time) { return (uint64_t(time.dwHighDateTime) << 32) | time.dwLowDateTime; };
+	return chrono::nanoseconds((ticks(kernel) + ticks(user)) * 100);
+#else
+	timespec time;
+	if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time) != 0)
+		return chrono::nanoseconds(0);
+	return chrono::seconds(time.tv_sec) + chrono::nanoseconds(time.tv_nsec);
+#endif
+}
+
+
+
+namespace {
+	/*! The measurements of one case. */
+	struct Measurement {
+		string			name;
+		double			nsPerOp;
+		double			cpuNsPerOp;
+		uintmax_t		iterations;
+		double			allocsPerOp;
+		double			bytesPerOp;
+		string			label;
+	};
+
+	/*! 'text' as a JSON string literal. */
+	[[nodiscard]] string json_string(string const& text) {
+		ostringstream json;
+		json << '"';
+		for (unsigned char c : text)
+			if (c == '"' || c == '\\')
+				json << '\\' << c;
+			else if (c < 0x20)
+				json << "\\u" << hex << setw(4) << setfill('0') << unsigned(c) << dec << setfill(' ');
+			else
+				json << c;
+		json << '"';
+		return json.str();
+	}
+
+	/*! The current UTC time as an ISO 8601 date and time. */
+	[[nodiscard]] string iso_date() {
+		auto const now = chrono::floor<chrono::seconds>(chrono::system_clock::now());
+		auto const day = chrono::floor<chrono::days>(now);
+		chrono::year_month_day const date(day);
+		chrono::hh_mm_ss const time(now - day);
+		ostringstream iso;
+		iso << setfill('0') << setw(4) << int(date.year()) << '-' << setw(2) << unsigned(date.month()) << '-' << setw(2) << unsigned(date.day())
+			<< 'T' << setw(2) << time.hours().count() << ':' << setw(2) << time.minutes().count() << ':' << setw(2) << time.seconds().count() << "+00:00";
+		return iso.str();
+	}
+
+	void write_json(ostream& os, string const& executable, vector<Measurement> const& results) {
+		os << "{\n  \"context\": {\n    \"date\": " << json_string(iso_date())
+			<< ",\n    \"executable\": " << json_string(executable)
+			<< ",\n    \"num_cpus\": " << max(thread::hardware_concurrency(), 1u)
+#if defined(NDEBUG)
+			<< ",\n    \"library_build_type\": \"release\""
+#else
+			<< ",\n    \"library_build_type\": \"debug\""
+#endif
+			<< "\n  },\n  \"benchmarks\": [";
+		os << setprecision(17);
+		for (size_t i = 0; i < results.size(); ++i) {
+			auto const& result = results[i];
+			os << (i == 0 ? "\n" : ",\n") << "    {\n"
+				<< "      \"name\": " << json_string(result.name) << ",\n"
+				<< "      \"run_name\": " << json_string(result.name) << ",\n"
+				<< "      \"run_type\": \"iteration\",\n"
+				<< "      \"iterations\": " << result.iterations << ",\n"
+				<< "      \"real_time\": " << result.nsPerOp << ",\n"
+				<< "      \"cpu_time\": " << result.cpuNsPerOp << ",\n"
+				<< "      \"time_unit\": \"ns\",\n"
+				<< "      \"allocs_per_op\": " << result.allocsPerOp << ",\n"
+				<< "      \"bytes_per_op\": " << result.bytesPerOp;
+			if (!result.label.empty())
+				os << ",\n      \"label\": " << json_string(result.label);
+			os << "\n    }";
+		}
+		os << "\n  ]\n}\n";
+	}
+}
+
+
+
+MAKEAPP(benchmark) {
+	auto const& args = get_args();
+	auto const json = find(args.begin(), args.end(), "--json") != args.end();
+	vector<string> filters;
+	for (auto arg = next(args.begin()); arg != args.end(); ++arg)
+		if (*arg != "--json")
+			filters.push_back(*arg);
+	auto selected = [&](bench::Case const* c) {
+		return filters.empty() || any_of(filters.begin(), filters.end(), [&](string const& filter) { return c->name().find(filter) != string::npos; });
+	};
+
+	vector<Measurement> results;
+	for (auto benchCase : bench::Case::registry()) {
+		if (!selected(benchCase))
+			continue;
+		bench::State state;
+		benchCase->execute(state);
+		Measurement result{ benchCase->name(), state.ns_per_op(), state.cpu_ns_per_op(), state.iterations(), state.allocs_per_op(), state.bytes_per_op(), state.label() };
+		if (!json) {
+			cout << left << setw(40) << result.name
+				<< right << setw(14) << fixed << setprecision(1) << result.nsPerOp << " ns/op"
+				<< setw(14) << result.iterations << " iterations"
+				<< setw(10) << setprecision(1) << result.allocsPerOp << " allocs/op"
+				<< setw(12) << setprecision(0) << result.bytesPerOp << " B/op";
+			if (!result.label.empty())
+				cout << "  " << result.label;
+			cout << endl;
+		}
+		results.push_back(move(result));
+	}
+
+	if (json)
+		write_json(cout, args.front(), results);
+	return EXIT_SUCCESS;
+}
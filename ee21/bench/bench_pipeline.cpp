@@ -0,0 +1,116 @@
+/*!	\file	bench_pipeline.cpp
+	\brief	Tokenizer, parser and evaluator benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Each stage of the pipeline timed on its own over a corpus of
+expressions of different lengths and kinds of operand: Tokenizer::
+tokenize(), Parser::parse() of the tokens, RPNEvaluator::evaluate()
+of the compiled program, and the whole ExpressionEvaluator::
+evaluate().  One case per stage and corpus entry, named
+'<stage>_<entry>'.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/expression_evaluator.hpp>
+#include <ee/integer.hpp>
+#include <ee/real.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+
+
+namespace {
+	/*! 'term' repeated 'count' times, joined by 'op'. */
+	[[nodiscard]] string chain(string const& term, string const& op, size_t count) {
+		string expression = term;
+		for (size_t i = 1; i < count; ++i)
+			expression += op + term;
+		return expression;
+	}
+
+	/*! Name and expression of each corpus entry; the variables a, b and c are set before evaluating. */
+	[[nodiscard]] vector<pair<string, string>> const& pipeline_corpus() {
+		static vector<pair<string, string>> const corpus{
+			{ "integer_short",		"1 + 2 * 3" },
+			{ "integer_long",		chain("(17 * 3 - 4) % 7", " + ", 32) },
+			{ "real_short",			"2.5 * 1.25" },
+			{ "real_long",			chain("3.75 / 1.5e2 - 0.125", " + ", 16) },
+			{ "boolean",			"true and not false or (1 < 2) xor (3 >= 4) nand false" },
+			{ "functions",			"sqrt(16) + abs(-4) + max(3, 7) + floor(2.5) + sin(0.5) + arctan2(1, 2)" },
+			{ "variables",			"a * b + c / (a - b) + a ** 2" },
+			{ "mixed_long",			chain("if(a > b, sqrt(c) * 1.5, c! - 3) + b % 4", " + ", 8) },
+		};
+		return corpus;
+	}
+
+	void set_pipeline_variables(ExpressionEvaluator& evaluator) {
+		(void)evaluator.evaluate("a = 12");
+		(void)evaluator.evaluate("b = 5");
+		(void)evaluator.evaluate("c = 9");
+	}
+
+	/*! Registers the four stage cases of every corpus entry. */
+	[[maybe_unused]] bool const pipelineCasesRegistered = [] {
+		for (auto const& [name, expression] : pipeline_corpus()) {
+			bench::register_case("tokenize_" + name, [expression = expression](bench::State& state) {
+				Tokenizer tokenizer;
+				while (state.keep_running())
+					bench::do_not_optimize(tokenizer.tokenize(expression));
+			});
+
+			bench::register_case("parse_" + name, [expression = expression](bench::State& state) {
+				Tokenizer tokenizer;
+				auto const infixTokens = tokenizer.tokenize(expression);
+				Parser parser;
+				state.reset_timer();
+				while (state.keep_running())
+					bench::do_not_optimize(parser.parse(infixTokens));
+			});
+
+			bench::register_case("rpn_" + name, [expression = expression](bench::State& state) {
+				ExpressionEvaluator evaluator;
+				set_pipeline_variables(evaluator);
+				auto const program = evaluator.compile(expression);
+				RPNEvaluator rpn;
+				state.reset_timer();
+				while (state.keep_running())
+					bench::do_not_optimize(rpn.evaluate(program));
+			});
+
+			bench::register_case("evaluate_" + name, [expression = expression](bench::State& state) {
+				ExpressionEvaluator evaluator;
+				set_pipeline_variables(evaluator);
+				state.reset_timer();
+				while (state.keep_running())
+					bench::do_not_optimize(evaluator.evaluate(expression));
+			});
+		}
+		return true;
+	}();
+}
@@ -0,0 +1,90 @@
+/*!	\file	bench_power.cpp
+	\brief	Power operator benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Benchmarks of the power expressions from the marker suite,
+evaluated end to end through ExpressionEvaluator.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/expression_evaluator.hpp>
+
+using namespace std;
+
+
+
+namespace {
+	void evaluate(bench::State& state, ExpressionEvaluator::expression_type const& expression) {
+		ExpressionEvaluator evaluator;
+		while (state.keep_running())
+			bench::do_not_optimize(evaluator.evaluate(expression));
+	}
+}
+
+
+
+BENCH_CASE(power_integer_5_2) {
+	evaluate(state, "5**2");
+}
+
+BENCH_CASE(power_integer_123_123) {
+	evaluate(state, "123**123");
+}
+
+BENCH_CASE(power_integer_negated) {
+	evaluate(state, "-7**2");
+}
+
+BENCH_CASE(power_integer_right_associative_4_3_2) {
+	evaluate(state, "4**3**2");
+}
+
+BENCH_CASE(power_integer_right_associative_2_3_4) {
+	evaluate(state, "2**3**4");
+}
+
+BENCH_CASE(power_integer_parenthesized) {
+	evaluate(state, "(2**3)**4");
+}
+
+BENCH_CASE(power_integer_negative_exponent) {
+	evaluate(state, "3**-20");
+}
+
+BENCH_CASE(power_real_integer_exponent) {
+	evaluate(state, "2.5**40");
+}
+
+BENCH_CASE(power_real_fractional_exponent) {
+	evaluate(state, "4.0 ** 0.5");
+}
+
+BENCH_CASE(power_function_real) {
+	evaluate(state, "pow(2.3,3.4)");
+}
+
+BENCH_CASE(power_trigonometric_identity) {
+	evaluate(state, "sin(1.0)**2+cos(1.0)**2");
+}
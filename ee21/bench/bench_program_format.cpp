@@ -0,0 +1,66 @@
+/*!	\file	bench_program_format.cpp
+	\brief	Binary program format benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Getting a ready-to-run Program for a formula with a 1000-digit
+literal: compiling its source text versus loading it from the
+binary program format.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/expression_evaluator.hpp>
+
+#include <span>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+
+
+namespace {
+	[[nodiscard]] string program_format_source() {
+		return "total = if(rate > 0, principal * (1.0 + rate) ** years, principal) + 0." + string(999, '3');
+	}
+}
+
+
+
+BENCH_CASE(program_format_compile_text) {
+	ExpressionEvaluator evaluator;
+	auto const source = program_format_source();
+	while (state.keep_running())
+		bench::do_not_optimize(evaluator.compile(source));
+}
+
+BENCH_CASE(program_format_load_binary) {
+	ExpressionEvaluator evaluator;
+	ostringstream os(ios::binary);
+	evaluator.save(evaluator.compile(program_format_source()), os);
+	auto const bytes = os.str();
+	state.set_label(to_string(bytes.size()) + " bytes");
+	while (state.keep_running())
+		bench::do_not_optimize(evaluator.load(as_bytes(span(bytes.data(), bytes.size()))));
+}
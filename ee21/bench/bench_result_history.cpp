@@ -0,0 +1,84 @@
+/*!	\file	bench_result_history.cpp
+	\brief	Result history benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Adding 1000-digit results to a bounded ResultHistory, with
+and without spilling evicted results to disk, and looking up
+spilled results.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/real.hpp>
+#include <ee/result_history.hpp>
+
+#include <filesystem>
+#include <string>
+
+using namespace std;
+
+
+
+namespace {
+	[[nodiscard]] Operand::pointer_type history_entry() {
+		return make_operand<Real>(Real::value_type(sqrt(Real::value_type(2))));
+	}
+
+	[[nodiscard]] filesystem::path spill_path() {
+		return filesystem::temp_directory_path() / "ee_bench_result_history.bin";
+	}
+}
+
+
+
+BENCH_CASE(result_history_add) {
+	ResultHistory history;
+	auto const entry = history_entry();
+	while (state.keep_running())
+		history.add(entry);
+}
+
+BENCH_CASE(result_history_add_spilled) {
+	ResultHistory history;
+	history.spill_to(spill_path());
+	auto const entry = history_entry();
+	while (state.keep_running())
+		history.add(entry);
+	if (history.size() > history.depth())
+		state.set_label(to_string(filesystem::file_size(spill_path()) / (history.size() - history.depth())) + " bytes/result on disk");
+}
+
+BENCH_CASE(result_history_lookup_spilled) {
+	constexpr ResultHistory::index_type SPILLED = 4096;
+	ResultHistory history(16);
+	history.spill_to(spill_path());
+	auto const entry = history_entry();
+	for (ResultHistory::index_type i = 0; i < SPILLED + history.depth(); ++i)
+		history.add(entry);
+	ResultHistory::index_type index = 1;
+	while (state.keep_running()) {
+		bench::do_not_optimize(history[index]);
+		index = index * 2654435761u % SPILLED + 1;
+	}
+}
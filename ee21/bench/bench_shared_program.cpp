@@ -0,0 +1,88 @@
+/*!	\file	bench_shared_program.cpp
+	\brief	Shared compiled program benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+One compiled program evaluated against per-thread
+EvaluationContexts, versus re-evaluating the expression text.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/expression_evaluator.hpp>
+#include <ee/evaluation_context.hpp>
+#include <ee/integer.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/thread_pool.hpp>
+
+#include <future>
+#include <vector>
+
+using namespace std;
+
+
+
+namespace {
+	constexpr unsigned SHARED_THREADS = 4;
+	constexpr int EVALUATIONS_PER_THREAD = 256;
+}
+
+
+
+BENCH_CASE(shared_program_evaluate_text) {
+	ExpressionEvaluator evaluator;
+	(void)evaluator.evaluate("x = 12");
+	while (state.keep_running())
+		bench::do_not_optimize(evaluator.evaluate("y = x * x + 1"));
+}
+
+BENCH_CASE(shared_program_evaluate_compiled) {
+	ExpressionEvaluator evaluator;
+	auto const program = evaluator.compile("y = x * x + 1");
+	RPNEvaluator rpn;
+	EvaluationContext context;
+	context.set(evaluator.slot("x"), make_operand<Integer>(Integer::value_type(12)));
+	while (state.keep_running())
+		bench::do_not_optimize(rpn.evaluate(program, context));
+}
+
+BENCH_CASE(shared_program_4_threads) {
+	ExpressionEvaluator evaluator;
+	auto const program = evaluator.compile("y = x * x + 1");
+	auto const x = evaluator.slot("x");
+	ThreadPool pool(SHARED_THREADS);
+	state.set_label("1024 evaluations");
+	while (state.keep_running()) {
+		vector<future<void>> done;
+		for (unsigned t = 0; t < SHARED_THREADS; ++t)
+			done.push_back(pool.submit([&program, x, t] {
+				RPNEvaluator rpn;
+				EvaluationContext context;
+				context.set(x, make_operand<Integer>(Integer::value_type(t)));
+				for (int i = 0; i < EVALUATIONS_PER_THREAD; ++i)
+					bench::do_not_optimize(rpn.evaluate(program, context));
+			}));
+		for (auto& d : done)
+			d.get();
+	}
+}
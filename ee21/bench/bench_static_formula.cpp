@@ -0,0 +1,77 @@
+/*!	\file	bench_static_formula.cpp
+	\brief	Static formula benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+One formula evaluated as a StaticFormula, as the same
+arithmetic written by hand, and by the interpreter.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/expression_evaluator.hpp>
+#include <ee/integer.hpp>
+#include <ee/static_formula.hpp>
+
+#include <cstdint>
+
+using namespace std;
+
+
+
+namespace {
+	using StaticPrice = StaticFormula<"(price * quantity - discount) % 1000003 + quantity / 3", std::int64_t, double>;
+
+	std::int64_t volatile staticPrice = 1999, staticQuantity = 48, staticDiscount = 250;
+}
+
+
+
+BENCH_CASE(static_formula_int64) {
+	while (state.keep_running())
+		bench::do_not_optimize(StaticPrice::evaluate(staticPrice, staticQuantity, staticDiscount));
+}
+
+BENCH_CASE(static_formula_hand_written) {
+	while (state.keep_running()) {
+		std::int64_t const price = staticPrice, quantity = staticQuantity, discount = staticDiscount;
+		bench::do_not_optimize((price * quantity - discount) % 1000003 + quantity / 3);
+	}
+}
+
+BENCH_CASE(static_formula_cpp_int) {
+	Integer::value_type const price = 1999, quantity = 48, discount = 250;
+	while (state.keep_running())
+		bench::do_not_optimize(StaticFormula<"(price * quantity - discount) % 1000003 + quantity / 3">::evaluate(price, quantity, discount));
+}
+
+BENCH_CASE(static_formula_interpreted) {
+	ExpressionEvaluator evaluator;
+	evaluator.context().set(evaluator.slot("price"), make_operand<Integer>(1999));
+	evaluator.context().set(evaluator.slot("quantity"), make_operand<Integer>(48));
+	evaluator.context().set(evaluator.slot("discount"), make_operand<Integer>(250));
+	auto const program = evaluator.compile("(price * quantity - discount) % 1000003 + quantity / 3");
+	RPNEvaluator rpn;
+	while (state.keep_running())
+		bench::do_not_optimize(rpn.evaluate(program, evaluator.context()));
+}
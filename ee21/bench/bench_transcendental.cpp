@@ -0,0 +1,87 @@
+/*!	\file	bench_transcendental.cpp
+	\brief	Transcendental function benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Throughput of the transcendental.hpp functions at 50, 100, and
+1000 digits.  Each case labels its result with the number of
+digits that agree with the boost::multiprecision reference.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Added exp().
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/real.hpp>
+#include <ee/transcendental.hpp>
+
+#include <string>
+#include <type_traits>
+
+using namespace std;
+
+
+
+namespace {
+	using Real50 = boost::multiprecision::number<boost::multiprecision::cpp_dec_float<50>>;
+	using Real100 = boost::multiprecision::number<boost::multiprecision::cpp_dec_float<100>>;
+	using Real1000 = Real::value_type;
+
+	/*! Times 'function' and labels the case with its agreement with 'reference', in digits. */
+	template <typename T, typename FUNCTION, typename REFERENCE>
+	void transcendental_case(bench::State& state, FUNCTION function, REFERENCE reference) {
+		T const x("2.3"), unit("-0.7");
+		T const result = function(x, unit);
+		T const expected = reference(x, unit);
+		T const error = abs(T(result - expected)) / abs(expected);
+		state.set_label(error == 0 ? "exact" : to_string(int(-log10(error).template convert_to<double>())) + " digits");
+
+		while (state.keep_running())
+			bench::do_not_optimize(function(x, unit));
+	}
+}
+
+
+
+#define TRANSCENDENTAL_CASE(name, digits, args)\
+	BENCH_CASE(name ## _ ## digits) {\
+		transcendental_case<Real ## digits>(state,\
+			[]([[maybe_unused]] auto const& x, [[maybe_unused]] auto const& unit) { return transcendental::name args; },\
+			[]([[maybe_unused]] auto const& x, [[maybe_unused]] auto const& unit) { return std::decay_t<decltype(x)>(boost::multiprecision::name args); });\
+	}
+
+#define TRANSCENDENTAL_CASES(name, args)\
+	TRANSCENDENTAL_CASE(name, 50, args)\
+	TRANSCENDENTAL_CASE(name, 100, args)\
+	TRANSCENDENTAL_CASE(name, 1000, args)
+
+TRANSCENDENTAL_CASES(sin, (x))
+TRANSCENDENTAL_CASES(cos, (x))
+TRANSCENDENTAL_CASES(tan, (x))
+TRANSCENDENTAL_CASES(atan, (x))
+TRANSCENDENTAL_CASES(asin, (unit))
+TRANSCENDENTAL_CASES(acos, (unit))
+TRANSCENDENTAL_CASES(atan2, (x, unit))
+TRANSCENDENTAL_CASES(exp, (x))
+TRANSCENDENTAL_CASES(log, (x))
+TRANSCENDENTAL_CASES(log10, (x))
+TRANSCENDENTAL_CASES(pow, (x, x))
@@ -0,0 +1,70 @@
+/*!	\file	bench_variables.cpp
+	\brief	Variable binding benchmarks.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Loading a row of 8 inputs: one assignment expression per
+variable versus EvaluationContext::bind() on their slots.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "bench.hpp"
+#include <ee/expression_evaluator.hpp>
+#include <ee/integer.hpp>
+
+#include <array>
+#include <string>
+
+using namespace std;
+
+
+
+namespace {
+	constexpr size_t ROW_WIDTH = 8;
+}
+
+
+
+BENCH_CASE(variables_assign_row) {
+	ExpressionEvaluator evaluator;
+	array<string, ROW_WIDTH> assignments;
+	for (size_t i = 0; i < ROW_WIDTH; ++i)
+		assignments[i] = "v" + to_string(i) + " = " + to_string(i * 7);
+	while (state.keep_running())
+		for (auto const& assignment : assignments)
+			bench::do_not_optimize(evaluator.evaluate(assignment));
+}
+
+BENCH_CASE(variables_bind_row) {
+	ExpressionEvaluator evaluator;
+	for (size_t i = 0; i < ROW_WIDTH; ++i)
+		(void)evaluator.slot("v" + to_string(i));
+	array<Operand::pointer_type, ROW_WIDTH> row;
+	for (size_t i = 0; i < ROW_WIDTH; ++i)
+		row[i] = make_operand<Integer>(Integer::value_type(i * 7));
+	auto const first = evaluator.slot("v0");
+	while (state.keep_running()) {
+		evaluator.context().bind(first, row);
+		bench::do_not_optimize(evaluator.context().value(first));
+	}
+}
@@ -9,6 +9,11 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Evaluates a Program on a reusable stack pre-sized from the parse-time depth.
+	Added evaluate(Program, EvaluationContext&).
+	Added evaluate(Profile&).
+
 Version 2021.11.01
 	C++ 20 validated
 	Changed to GATS_TEST
@@ -33,11 +38,30 @@ the program(s) have been supplied.
 =============================================================*/
 
 #include <ee/operand.hpp>
+#include <ee/parser.hpp>
+#include <ee/evaluation_context.hpp>
+#include <vector>
+
+class Profile;
 
 class RPNEvaluator {
 	RPNEvaluator(RPNEvaluator const&) = delete;
 	RPNEvaluator& operator = (RPNEvaluator const&) = delete;
+
+	std::vector<Operand::pointer_type>	stack_m;	// reused across evaluations, sized by Program::stack_depth()
 public:
 	RPNEvaluator() = default;
 	[[nodiscard]] Operand::pointer_type evaluate( TokenList const& container );
+	[[nodiscard]] Operand::pointer_type evaluate( Program const& program );
+
+	/*! Evaluates 'program' with 'context' active: its variables and results are read and
+		written in 'context', and the value is appended to its result history.  Programs are not modified by evaluation, so threads can share
+		one program, each with its own evaluator and context.  An assignment yields its
+		Variable, whose value is in 'context' at the variable's slot(). */
+	[[nodiscard]] Operand::pointer_type evaluate( Program const& program, EvaluationContext& context );
+
+	/*! Evaluates profile.program(), adding the time and calls of each operation to 'profile'. */
+	[[nodiscard]] Operand::pointer_type evaluate( Profile& profile );
+private:
+	[[nodiscard]] Operand::pointer_type run( Program const& program, Profile* profile );
 };
@@ -0,0 +1,129 @@
+#pragma once
+/*!	\file	boolean_column.hpp
+	\brief	BooleanColumn class declaration.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A column of Boolean values packed 64 rows per word, so the
+logical operators work on 64 rows per instruction.  Row i is
+bit (i % 64) of word (i / 64); the bits past size() in the last
+word are always zero, so count() and the comparisons of whole
+words need no masking.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+
+/*! Bit-packed column of Booleans. */
+class BooleanColumn {
+public:
+	using word_type = std::uint64_t;
+	static constexpr std::size_t WORD_BITS = 64;
+private:
+	std::vector<word_type>	words_m;
+	std::size_t				size_m = 0;
+public:
+	BooleanColumn() = default;
+
+	/*! 'size' rows, all 'value'. */
+	explicit BooleanColumn(std::size_t size, bool value = false)
+		: words_m((size + WORD_BITS - 1) / WORD_BITS, value ? ~word_type(0) : 0), size_m(size) { clear_tail(); }
+
+	BooleanColumn(std::initializer_list<bool> values) : BooleanColumn(values.size()) {
+		std::size_t i = 0;
+		for (bool value : values)
+			set(i++, value);
+	}
+
+	[[nodiscard]] std::size_t	size() const { return size_m; }
+	[[nodiscard]] bool			empty() const { return size_m == 0; }
+
+	[[nodiscard]] bool operator [] (std::size_t row) const {
+		assert(row < size_m);
+		return (words_m[row / WORD_BITS] >> (row % WORD_BITS)) & 1;
+	}
+
+	void set(std::size_t row, bool value) {
+		assert(row < size_m);
+		auto const bit = word_type(1) << (row % WORD_BITS);
+		if (value)
+			words_m[row / WORD_BITS] |= bit;
+		else
+			words_m[row / WORD_BITS] &= ~bit;
+	}
+
+	/*! Number of true rows. */
+	[[nodiscard]] std::size_t count() const {
+		std::size_t n = 0;
+		for (auto word : words_m)
+			n += std::popcount(word);
+		return n;
+	}
+
+	/*! The packed rows.  Writers must leave the bits past size() zero, or call clear_tail(). */
+	[[nodiscard]] std::span<word_type const>	words() const { return words_m; }
+	[[nodiscard]] std::span<word_type>			words() { return words_m; }
+
+	/*! Zeroes the bits past size() in the last word. */
+	void clear_tail() {
+		if (auto const used = size_m % WORD_BITS)
+			words_m.back() &= (word_type(1) << used) - 1;
+	}
+
+	/*! Negates every row. */
+	BooleanColumn& flip() {
+		for (auto& word : words_m)
+			word = ~word;
+		clear_tail();
+		return *this;
+	}
+
+	BooleanColumn& operator &= (BooleanColumn const& rhs) { return combine(rhs, [](word_type l, word_type r) { return l & r; }); }
+	BooleanColumn& operator |= (BooleanColumn const& rhs) { return combine(rhs, [](word_type l, word_type r) { return l | r; }); }
+	BooleanColumn& operator ^= (BooleanColumn const& rhs) { return combine(rhs, [](word_type l, word_type r) { return l ^ r; }); }
+
+	/*! Replaces each row with op(row, rhs row), a word at a time; op(0, 0) must be 0 or clear_tail() must follow. */
+	template <typename WORD_OP>
+	BooleanColumn& combine(BooleanColumn const& rhs, WORD_OP op) {
+		assert(rhs.size_m == size_m);
+		for (std::size_t i = 0; i < words_m.size(); ++i)
+			words_m[i] = op(words_m[i], rhs.words_m[i]);
+		return *this;
+	}
+
+	[[nodiscard]] friend bool operator == (BooleanColumn const& lhs, BooleanColumn const& rhs) {
+		return lhs.size_m == rhs.size_m && lhs.words_m == rhs.words_m;
+	}
+};
+
+[[nodiscard]] inline BooleanColumn operator & (BooleanColumn lhs, BooleanColumn const& rhs) { return lhs &= rhs; }
+[[nodiscard]] inline BooleanColumn operator | (BooleanColumn lhs, BooleanColumn const& rhs) { return lhs |= rhs; }
+[[nodiscard]] inline BooleanColumn operator ^ (BooleanColumn lhs, BooleanColumn const& rhs) { return lhs ^= rhs; }
+[[nodiscard]] inline BooleanColumn operator ~ (BooleanColumn column) { return column.flip(); }
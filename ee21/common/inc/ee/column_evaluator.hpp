@@ -0,0 +1,95 @@
+#pragma once
+/*!	\file	column_evaluator.hpp
+	\brief	ColumnEvaluator class declaration.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Evaluates a Boolean-valued Program over a batch of rows at once.
+Each variable of the program is bound to a column of the batch;
+the result is a BooleanColumn with one bit per row.
+
+A program may use variables, Boolean, Integer and Real literals
+(with unary + and -), the relational operators, and the logical
+operators and, or, xor, nand, nor, xnor and not.  The logical
+operators, and the relational operators on two Boolean operands,
+run on 64 rows per word.  Numeric columns hold std::int64_t or
+double; an Integer is compared with a Real as a double.
+
+select() returns the indices of the rows for which a predicate
+is true (a selection vector), and can be restricted to the rows
+of an earlier selection.  A comparison of two numeric operands
+is then evaluated on those rows only; other predicates are
+evaluated for the whole batch and the selected rows kept.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Added select() and Selection.
+	select() checks the rows of an earlier selection.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/boolean_column.hpp>
+#include <ee/parser.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+
+using IntegerColumn = std::vector<std::int64_t>;
+using RealColumn = std::vector<double>;
+
+/*! One value per row of a batch. */
+using Column = std::variant<BooleanColumn, IntegerColumn, RealColumn>;
+
+/*! Row indices of a batch, in increasing order. */
+using Selection = std::vector<std::uint32_t>;
+
+
+class ColumnEvaluator {
+	std::size_t									rows_m;
+	std::unordered_map<std::size_t, Column>		columns_m;		// variable slot -> column
+public:
+	explicit ColumnEvaluator(std::size_t rows) : rows_m(rows) { }
+
+	/*! Binds the variable 'slot' (see ExpressionEvaluator::slot()) to 'column', replacing any earlier column.
+		@throws std::runtime_error if the column does not have rows() rows. */
+	void bind(std::size_t slot, Column column);
+
+	[[nodiscard]] std::size_t rows() const { return rows_m; }
+
+	/*! The value of 'program' for every row.
+		@throws std::runtime_error if the program uses an unbound variable or an unsupported
+			operation, or its operands or value are not of the kinds above. */
+	[[nodiscard]] BooleanColumn evaluate(Program const& program) const;
+
+	/*! The rows for which the Boolean 'predicate' is true.
+		@throws std::runtime_error as evaluate(), or if rows() does not fit a Selection index. */
+	[[nodiscard]] Selection select(Program const& predicate) const;
+
+	/*! The rows of 'rows' for which the Boolean 'predicate' is true.
+		@throws std::runtime_error as evaluate(), or if a row of 'rows' is not below rows(). */
+	[[nodiscard]] Selection select(Program const& predicate, Selection const& rows) const;
+
+private:
+	/*! select() of 'rows', or of every row when 'rows' is null. */
+	[[nodiscard]] Selection select_rows(Program const& predicate, Selection const* rows) const;
+};
@@ -0,0 +1,70 @@
+#pragma once
+/*!	\file	column_filter.hpp
+	\brief	ColumnFilter class declaration.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Selects the rows of a batch that satisfy a conjunction such as
+'price > 100 and qty < 5 and region == 3'.  The top-level 'and'
+operands are evaluated one at a time, each on the rows that
+survived the ones before it, so a selective predicate placed
+first saves the work of the rest.
+
+The filter measures each predicate's cost per row and the
+fraction of rows it keeps, and after every batch orders the
+predicates by cost / (1 - selectivity): cheap predicates that
+reject many rows run first.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/column_evaluator.hpp>
+#include <ee/parser.hpp>
+#include <cstddef>
+#include <vector>
+
+
+class ColumnFilter {
+public:
+	/*! One operand of the conjunction, with its measurements. */
+	struct Predicate {
+		Program			program;
+		double			cost = 0.0;				// nanoseconds per input row, moving average
+		double			selectivity = 0.0;		// fraction of input rows kept, moving average
+		std::size_t		evaluations = 0;
+	};
+
+	/*! Weight of the newest measurement in the moving averages. */
+	static constexpr double SMOOTHING = 0.25;
+private:
+	std::vector<Predicate>	predicates_m;
+public:
+	/*! Splits 'program' at its top-level 'and' operators.  A program containing if() is kept whole. */
+	explicit ColumnFilter(Program const& program);
+
+	/*! The rows of 'columns' for which the program is true; then reorders the predicates.
+		@throws std::runtime_error as ColumnEvaluator::select(). */
+	[[nodiscard]] Selection select(ColumnEvaluator const& columns);
+
+	/*! The predicates, in the order the next select() runs them. */
+	[[nodiscard]] std::vector<Predicate> const& predicates() const { return predicates_m; }
+};
@@ -0,0 +1,77 @@
+#pragma once
+/*!	\file	cpp_emitter.hpp
+	\brief	C++ source generation for compiled programs.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Writes a compiled Program as the source of an inline C++
+function, so a formula can be compiled into another program.
+
+The generated function calls helpers written once per file by
+emit_cpp_prelude().  The helpers implement the operations of
+operator.cpp and function.cpp on one of two sets of types:
+	Multiprecision	boost cpp_int and the 1000-digit cpp_dec_float
+					Real, with the Real functions of transcendental.hpp
+					(header only); the results are the interpreter's.
+	Native			std::int64_t and double with <cmath>; Integer
+					results that do not fit throw, and Reals are rounded
+					as doubles.
+The helpers apply the values Factorial::max_argument and
+Power::max_result_bits have when the prelude is written.
+The program's variables become the function's parameters, in
+order of first use; their types are template parameters.
+
+Sub-expressions with no variables whose value is an Integer or
+a Boolean are evaluated while emitting and written as literals,
+unless folding is turned off with CppFolding::None.
+
+Types are fixed at compile time, so an Integer raised to a
+negative Integer power throws instead of returning a Real, the
+branches of if() are converted to a common type, and operands
+of the wrong type are compile errors.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Added CppFolding.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/parser.hpp>
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+
+
+/*! The numeric types of generated code. */
+enum class CppNumbers { Multiprecision, Native };
+
+/*! Whether constant sub-expressions are evaluated while emitting, or left to the generated code. */
+enum class CppFolding { Constants, None };
+
+/*! Writes the includes and helpers used by the functions emit_cpp() writes.
+	The helpers are guarded, so the prelude may be written more than once per file. */
+void emit_cpp_prelude(std::ostream& os, CppNumbers numbers);
+
+/*! Writes 'program' as the inline C++ function 'name'; 'variable_name' names each variable slot it uses.
+	@throws std::runtime_error if the program assigns a variable, calls result(), or has a literal that
+		does not fit the Native types. */
+void emit_cpp(std::ostream& os, Program const& program, std::string const& name, CppNumbers numbers,
+	std::function<Token::string_type(std::size_t slot)> const& variable_name, CppFolding folding = CppFolding::Constants);
@@ -0,0 +1,122 @@
+#pragma once
+/*!	\file	evaluation_context.hpp
+	\brief	EvaluationContext class declaration.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Storage for variable values.  The Tokenizer resolves each
+variable name to a dense slot index when an expression is
+compiled; the values live in a contiguous array indexed by slot,
+so a read is an index load and a row of inputs is bound with
+a single copy.
+
+Every set() stamps its slot with a version drawn from a clock
+shared by all contexts, so a reader that remembers
+last_version() can tell which slots changed since.
+
+A context also keeps the history read by the Result function,
+a bounded ResultHistory.
+Compiled programs hold no values, so one Program can be shared
+by several threads: each thread activates its own context with
+an EvaluationContext::Scope, and variables and Result read and
+write the active context instead of their home context.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Added the result history, Scope and active().
+	The result history is a bounded ResultHistory.
+	active() is inline.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/operand.hpp>
+#include <ee/result_history.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+/*! Slot-indexed variable values and the result history.
+	Copying a context copies its bindings, which is a cheap way to give each request its own. */
+class EvaluationContext {
+public:
+	using version_type = std::uint64_t;
+
+	/*! Makes a context the active one on this thread for the lifetime of the scope. */
+	class Scope {
+		Scope(Scope const&) = delete;
+		Scope& operator = (Scope const&) = delete;
+		EvaluationContext* previous_m;
+	public:
+		explicit Scope(EvaluationContext& context);
+		~Scope();
+	};
+private:
+	std::vector<Operand::pointer_type>	values_m;
+	std::vector<version_type>			versions_m;
+	ResultHistory						results_m;
+
+	// inline so that a slot variable's read of the active context is inlined too
+	static inline thread_local EvaluationContext* active_sm = nullptr;
+public:
+	EvaluationContext() = default;
+	explicit EvaluationContext(std::size_t slots) : values_m(slots), versions_m(slots) { }
+
+	[[nodiscard]] std::size_t size() const { return values_m.size(); }
+
+	/*! Grows the context to at least 'slots' slots; new slots are uninitialized. */
+	void reserve_slots(std::size_t slots);
+
+	/*! The value in 'slot', null if it has not been set. */
+	[[nodiscard]] Operand::pointer_type const& value(std::size_t slot) const { return slot < values_m.size() ? values_m[slot] : unset(); }
+
+	/*! The version stamped by the last set() of 'slot', 0 if it has not been set. */
+	[[nodiscard]] version_type version(std::size_t slot) const { return slot < versions_m.size() ? versions_m[slot] : 0; }
+
+	/*! Sets 'slot', growing the context if needed. */
+	void set(std::size_t slot, Operand::pointer_type const& value);
+
+	/*! Sets the slots first, first+1, ... from 'row' in one pass. */
+	void bind(std::size_t first, std::span<Operand::pointer_type const> row);
+
+	/*! The result history, for configuring its depth and spilling. */
+	[[nodiscard]] ResultHistory& results() { return results_m; }
+	[[nodiscard]] ResultHistory const& results() const { return results_m; }
+
+	/*! Number of results added to the history. */
+	[[nodiscard]] ResultHistory::index_type result_count() const { return results_m.size(); }
+
+	/*! The 1-based 'index'th result.
+		@throws std::runtime_error if there is no such result or it has been discarded. */
+	[[nodiscard]] Operand::pointer_type result(ResultHistory::index_type index) const { return results_m[index]; }
+
+	/*! Appends 'result' to the history. */
+	void add_result(Operand::pointer_type const& result) { results_m.add(result); }
+
+	/*! The context activated on this thread by the innermost Scope, or null. */
+	[[nodiscard]] static EvaluationContext* active() { return active_sm; }
+
+	/*! The most recent version stamped by any context. */
+	[[nodiscard]] static version_type last_version();
+
+private:
+	[[nodiscard]] static Operand::pointer_type const& unset();
+};
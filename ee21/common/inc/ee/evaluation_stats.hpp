@@ -0,0 +1,112 @@
+#pragma once
+/*!	\file	evaluation_stats.hpp
+	\brief	EvaluationStats class declaration.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Per-stage measurements of the evaluation pipeline: for the
+tokenize, parse and evaluate stages, the number of runs, their
+total and longest wall-clock time and the Tokens they allocated;
+for the compiled expressions, the number of infix and postfix
+tokens and the deepest evaluation stack.
+
+ExpressionEvaluator collects them while enable_stats(true) is
+in effect.  Timing a stage costs two steady_clock reads; when
+stats are disabled it costs one test of a flag.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/token.hpp>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+
+/*! The stages of ExpressionEvaluator::evaluate(). */
+enum class Stage { Tokenize, Parse, Evaluate };
+
+/*! Measurements of one stage. */
+struct StageStats {
+	using duration = std::chrono::nanoseconds;
+
+	std::uint64_t	runs = 0;
+	duration		total{};
+	duration		longest{};
+	std::uint64_t	allocations = 0;		// Tokens allocated
+
+	[[nodiscard]] duration mean() const { return runs == 0 ? duration{} : total / static_cast<duration::rep>(runs); }
+};
+
+
+class EvaluationStats {
+public:
+	static constexpr std::size_t STAGES = 3;
+private:
+	std::array<StageStats, STAGES>	stages_m;
+	std::uint64_t					expressions_m = 0;
+	std::uint64_t					tokens_m = 0;			// infix tokens of the compiled expressions
+	std::uint64_t					programTokens_m = 0;	// postfix tokens of the compiled expressions
+	std::size_t						maxStackDepth_m = 0;
+public:
+	[[nodiscard]] StageStats const& operator [] (Stage stage) const { return stages_m[std::size_t(stage)]; }
+
+	/*! Number of expressions compiled. */
+	[[nodiscard]] std::uint64_t	expressions() const { return expressions_m; }
+	[[nodiscard]] std::uint64_t	tokens() const { return tokens_m; }
+	[[nodiscard]] std::uint64_t	program_tokens() const { return programTokens_m; }
+	[[nodiscard]] std::size_t	max_stack_depth() const { return maxStackDepth_m; }
+
+	void reset() { *this = EvaluationStats(); }
+
+	/*! Runs f() as 'stage', adding its time and Token allocations.  A stage that throws is not counted. */
+	template <typename F>
+	decltype(auto) time(Stage stage, F&& f) {
+		using clock = std::chrono::steady_clock;
+		auto const allocations = Token::allocations();
+		auto const start = clock::now();
+		decltype(auto) result = f();
+		auto const elapsed = std::chrono::duration_cast<StageStats::duration>(clock::now() - start);
+
+		auto& stats = stages_m[std::size_t(stage)];
+		++stats.runs;
+		stats.total += elapsed;
+		if (elapsed > stats.longest)
+			stats.longest = elapsed;
+		stats.allocations += Token::allocations() - allocations;
+		return result;
+	}
+
+	/*! Adds a compiled expression of 'tokens' infix tokens, 'programTokens' postfix tokens and evaluation stack 'stackDepth'. */
+	void add_expression(std::size_t tokens, std::size_t programTokens, std::size_t stackDepth) {
+		++expressions_m;
+		tokens_m += tokens;
+		programTokens_m += programTokens;
+		if (stackDepth > maxStackDepth_m)
+			maxStackDepth_m = stackDepth;
+	}
+};
+
+/*! Writes a table of the stages followed by the expression counts. */
+std::ostream& operator << (std::ostream& os, EvaluationStats const& stats);
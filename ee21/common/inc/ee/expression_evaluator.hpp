@@ -9,6 +9,17 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added result history for the Result function.
+	Added watch(), watched() and update() for incremental re-evaluation.
+	Added slot() and context() for binding variables by slot.
+	The result history lives in context(); added compile().
+	Added save() and load() for the binary program format.
+	Added emit_cpp().
+	Added enable_stats() and stats().
+	Added profile().
+	emit_cpp() can leave constants unfolded.
+
 Version 2021.11.01
 	C++ 20 validated
 
@@ -32,16 +43,86 @@ the program(s) have been supplied.
 #include <ee/parser.hpp>
 #include <ee/RPNEvaluator.hpp>
 #include <ee/function.hpp>
+#include <ee/incremental_program.hpp>
+#include <ee/cpp_emitter.hpp>
+#include <ee/evaluation_stats.hpp>
+#include <ee/profile.hpp>
+#include <cstddef>
+#include <ostream>
+#include <span>
+#include <map>
+#include <vector>
 
 
 class ExpressionEvaluator {
 public:
 	using expression_type = Token::string_type;
 	using result_type = Token::pointer_type;
+	using watch_id = std::size_t;
 private:
 	Tokenizer		tokenizer_m;
 	Parser			parser_m;
 	RPNEvaluator	rpn_m;
+
+	std::vector<IncrementalProgram>					watched_m;
+	std::map<Variable const*, std::vector<watch_id>>	dependents_m;	// variable -> watched expressions that read it
+	std::vector<watch_id>							volatile_m;		// watched expressions that call Result
+	Variable::version_type							updated_m = 0;	// variable clock at the last update()
+
+	EvaluationStats	stats_m;
+	bool			statsEnabled_m = false;
+
+	/*! f(), timed as 'stage' if stats are enabled. */
+	template <typename F>
+	decltype(auto) run_stage(Stage stage, F&& f) {
+		return statsEnabled_m ? stats_m.time(stage, f) : f();
+	}
 public:
 	[[nodiscard]] result_type evaluate(expression_type const& expr);
+
+	/*! Compiles 'expr' without evaluating it.  The program's variables are slots of context();
+		it can be evaluated by any RPNEvaluator against any EvaluationContext, from any thread. */
+	[[nodiscard]] Program compile(expression_type const& expr);
+
+	/*! Compiles 'expr' and evaluates it 'repetitions' times, timing each operation (see profile.hpp).
+		The values are not added to the result history. */
+	[[nodiscard]] Profile profile(expression_type const& expr, std::size_t repetitions = 1);
+
+	/*! Starts or stops collecting stats() in evaluate() and compile(); collected stats are kept. */
+	void enable_stats(bool enable = true) { statsEnabled_m = enable; }
+	[[nodiscard]] bool stats_enabled() const { return statsEnabled_m; }
+
+	/*! The measurements collected while stats were enabled (see evaluation_stats.hpp). */
+	[[nodiscard]] EvaluationStats const& stats() const { return stats_m; }
+	void reset_stats() { stats_m.reset(); }
+
+	/*! Writes 'program', compiled by this evaluator, in the binary program format (see serialization.hpp). */
+	void save(Program const& program, std::ostream& os) const;
+
+	/*! Loads a program written by save(), binding its variables by name to this evaluator's.
+		'bytes' may be a memory-mapped file; the program does not refer to it once loaded. */
+	[[nodiscard]] Program load(std::span<std::byte const> bytes);
+
+	/*! Writes 'program', compiled by this evaluator, as the C++ function 'name' (see cpp_emitter.hpp). */
+	void emit_cpp(Program const& program, std::string const& name, CppNumbers numbers, std::ostream& os,
+		CppFolding folding = CppFolding::Constants) const;
+
+	/*! The slot of the variable 'name' in context(), creating the variable if it is new. */
+	[[nodiscard]] std::size_t slot(expression_type const& name) { return tokenizer_m.slot_of(name); }
+
+	/*! The values of this evaluator's variables, indexed by slot, and its result history. */
+	[[nodiscard]] EvaluationContext& context() { return *tokenizer_m.context(); }
+
+	/*! Compiles and evaluates 'expr' in dependency-tracking mode.  The expression is kept
+		and update() re-evaluates it when a variable it reads is set.  Watched values are
+		not added to the result history. */
+	[[nodiscard]] watch_id watch(expression_type const& expr);
+
+	/*! The value of a watched expression as of its last evaluation. */
+	[[nodiscard]] result_type watched(watch_id id) const { return watched_m.at(id).value(); }
+
+	/*! Re-evaluates the watched expressions that read a variable set since the last update,
+		recomputing only their dirty sub-trees.
+		@return the number of expressions re-evaluated. */
+	std::size_t update();
 };
@@ -0,0 +1,98 @@
+#pragma once
+/*!	\file	formula_graph.hpp
+	\brief	FormulaGraph class declaration.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A persistent set of named formulas ('a = b + c') recalculated
+in dependency order, spreadsheet style.  Formulas are grouped
+into levels: every formula reads only variables assigned by
+lower levels, so the formulas of one level run in parallel on
+a ThreadPool.  Definitions that would close a cycle are
+rejected.  Recalculation only re-evaluates formulas whose
+inputs changed, and within them only the dirty sub-expressions
+(see IncrementalProgram).
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/incremental_program.hpp>
+#include <ee/parser.hpp>
+#include <ee/thread_pool.hpp>
+#include <ee/tokenizer.hpp>
+#include <ee/variable.hpp>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+class FormulaGraph {
+	FormulaGraph(FormulaGraph const&) = delete;
+	FormulaGraph& operator = (FormulaGraph const&) = delete;
+public:
+	using name_type = Token::string_type;
+	using expression_type = Token::string_type;
+private:
+	/*! One named formula and the variable it assigns. */
+	struct Formula {
+		Variable::pointer_type		target;
+		expression_type				expression;
+		std::unique_ptr<IncrementalProgram>	program;
+	};
+
+	Tokenizer							tokenizer_m;
+	Parser								parser_m;
+	std::map<name_type, Formula>		formulas_m;
+	std::vector<std::vector<name_type>>	levels_m;
+	std::unique_ptr<ThreadPool>			pool_m;
+
+public:
+	/*! 'threads' workers evaluate independent formulas; 0 or 1 recalculates serially. */
+	explicit FormulaGraph(unsigned threads = std::thread::hardware_concurrency());
+
+	/*! Adds or replaces the formula 'expression', which must have the form 'name = expression'.
+		@return the assigned name.
+		@throws std::runtime_error if the formula is malformed or would create a cycle; the graph is unchanged. */
+	name_type define(expression_type const& expression);
+
+	/*! Removes the formula that assigns 'name'; its variable keeps its last value. */
+	void remove(name_type const& name);
+
+	/*! Re-evaluates, level by level, the formulas whose inputs changed since they were last evaluated.
+		@return the number of formulas evaluated. */
+	std::size_t recalculate();
+
+	/*! The current value of the variable 'name'.
+		@throws std::runtime_error if 'name' has not been assigned. */
+	[[nodiscard]] Operand::pointer_type value(name_type const& name);
+
+	/*! The formula names grouped by evaluation level, lowest first. */
+	[[nodiscard]] std::vector<std::vector<name_type>> const& levels() const { return levels_m; }
+
+	[[nodiscard]] std::size_t size() const { return formulas_m.size(); }
+
+private:
+	[[nodiscard]] static std::vector<std::vector<name_type>> schedule(std::map<name_type, Formula> const& formulas);
+};
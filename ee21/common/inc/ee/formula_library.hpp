@@ -0,0 +1,95 @@
+#pragma once
+/*!	\file	formula_library.hpp
+	\brief	FormulaLibrary class declaration.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A file of named compiled formulas.  write() compiles the
+formulas and stores each in the binary program format (see
+serialization.hpp) behind a hash index of their names.
+
+Opening a library memory-maps the file and checks its header;
+nothing is read per formula until it is looked up, so opening
+takes the same time for ten formulas as for a hundred thousand.
+find() probes the index in O(1) expected time and returns the
+formula's bytes in place; load() rebuilds the Program from them.
+
+File layout, in host byte order:
+	header
+	index: bucketCount buckets of { name hash, name offset and
+		length, program offset and size }, open addressing with
+		linear probing, at most half full
+	names
+	programs
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/expression_evaluator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+class FormulaLibrary {
+	FormulaLibrary(FormulaLibrary const&) = delete;
+	FormulaLibrary& operator = (FormulaLibrary const&) = delete;
+public:
+	using name_type = Token::string_type;
+	using expression_type = Token::string_type;
+private:
+	struct Mapping;
+	struct Bucket;
+
+	std::unique_ptr<Mapping>	mapping_m;
+	Bucket const*				index_m = nullptr;
+	std::size_t					buckets_m = 0;
+	std::span<std::byte const>	names_m;
+	std::span<std::byte const>	programs_m;
+	std::size_t					size_m = 0;
+public:
+	/*! Compiles 'formulas', pairs of name and expression, with 'evaluator' and writes them to 'path'.
+		@throws std::runtime_error if a formula does not compile, a name is repeated, or the file cannot be written. */
+	static void write(std::filesystem::path const& path, ExpressionEvaluator& evaluator, std::vector<std::pair<name_type, expression_type>> const& formulas);
+
+	/*! Maps the library file 'path'.
+		@throws std::runtime_error if the file cannot be mapped or is not a library of this format version. */
+	explicit FormulaLibrary(std::filesystem::path const& path);
+	~FormulaLibrary();
+
+	/*! Number of formulas in the library. */
+	[[nodiscard]] std::size_t size() const { return size_m; }
+
+	[[nodiscard]] bool contains(std::string_view name) const { return !find(name).empty(); }
+
+	/*! The binary program stored under 'name', in the mapped file; empty if there is none. */
+	[[nodiscard]] std::span<std::byte const> find(std::string_view name) const;
+
+	/*! The program stored under 'name', with its variables bound to 'evaluator'.
+		@throws std::runtime_error if there is no formula 'name'. */
+	[[nodiscard]] Program load(std::string_view name, ExpressionEvaluator& evaluator) const;
+};
@@ -8,6 +8,7 @@
 =============================================================
 Declarations of the Function classes derived from Operation.  
 Includes the subclasses:
+	FunctionCache
 	OneArgFunction
 		Abs
 		Arccos
@@ -32,11 +33,17 @@ Includes the subclasses:
 		Pow
 
 	ThreeArgFunction
+		If
 
 =============================================================
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added If, declared perform() on the concrete functions.
+	Added FunctionCache.
+	Result reads the history of the active EvaluationContext.
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -70,11 +77,43 @@ the program(s) have been supplied.
 
 #include <ee/operation.hpp>
 #include <ee/integer.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 /*! Function token base class. */
 class Function : public Operation { };
 
+
+/*!	Bounded memo cache of pure function results, keyed on the function type, the argument
+	values and the Real precision.  Least recently used entries are evicted once 'capacity'
+	is reached; a capacity of 0 (the default) disables the cache.  Result is never cached
+	because its value depends on the evaluation history. */
+class FunctionCache {
+public:
+	/*! Lookup counters since the last clear(). */
+	struct Statistics {
+		std::uint64_t hits = 0;
+		std::uint64_t misses = 0;
+		std::uint64_t evictions = 0;
+		[[nodiscard]] double hit_rate() const { return hits + misses == 0 ? 0.0 : double(hits) / double(hits + misses); }
+	};
+
+	[[nodiscard]] static std::size_t capacity();
+	static void set_capacity(std::size_t entries);
+	[[nodiscard]] static std::size_t size();
+	[[nodiscard]] static Statistics statistics();
+
+	/*! Removes every entry and zeroes the statistics. */
+	static void clear();
+
+	/*! Returns the cached result of 'function' on 'args', or nullptr.  Lookups are only counted while the cache is enabled. */
+	[[nodiscard]] static Operand::pointer_type find(Function const& function, ArgumentList args);
+
+	/*! Stores 'result' as the value of 'function' on 'args'. */
+	static void insert(Function const& function, ArgumentList args, Operand::pointer_type const& result);
+};
+
 		/*! One argument function token base class. */
 		class OneArgFunction : public Function {
 		public:
@@ -82,49 +121,49 @@ class Function : public Operation { };
 		};
 
 				/*! Absolute value function token. */
-				class Abs : public OneArgFunction {	};
+				class Abs : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! arc cosine function token. */
-				class Arccos : public OneArgFunction { };
+				class Arccos : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! arc sine function token. */
-				class Arcsin : public OneArgFunction { };
+				class Arcsin : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! arc tangent function token.  Argument is the slope. */
-				class Arctan : public OneArgFunction { };
+				class Arctan : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! ceil function token. */
-				class Ceil : public OneArgFunction { };
+				class Ceil : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! cosine function token. */
-				class Cos : public OneArgFunction { };
+				class Cos : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! exponential function token.  pow(e,x), where 'e' is the euler constant and 'x' is the exponent. */
-				class Exp : public OneArgFunction { };
+				class Exp : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! floor function token. */
-				class Floor : public OneArgFunction { };
+				class Floor : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! logarithm base 2 function token. */
-				class Lb : public OneArgFunction { };
+				class Lb : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! natural logarithm function token. */
-				class Ln : public OneArgFunction { };
+				class Ln : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! logarithm base 10 function token. */
-				class Log : public OneArgFunction { };
+				class Log : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
-				/*! previous result token. Argument is the 1-base index of the result. */
-				class Result : public OneArgFunction { };
+				/*! previous result token. Argument is the 1-base index of the result in the active EvaluationContext's history. */
+				class Result : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! sine function token. */
-				class Sin : public OneArgFunction { };
+				class Sin : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! Square root token. */
-				class Sqrt : public OneArgFunction { };
+				class Sqrt : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! tangeant function. */
-				class Tan : public OneArgFunction { };
+				class Tan : public OneArgFunction { DECL_OPERATION_PERFORM() };
 
 
 		/*!	Two argument function token base class. */
@@ -135,16 +174,16 @@ class Function : public Operation { };
 
 				/*! 2 parameter arc tangent function token.
 					First argument is the change in Y, second argument is the change in X. */
-				class Arctan2 : public TwoArgFunction { };
+				class Arctan2 : public TwoArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! Maximum of 2 elements function token. */
-				class Max : public TwoArgFunction { };
+				class Max : public TwoArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! Minimum of 2 elements function token. */
-				class Min : public TwoArgFunction { };
+				class Min : public TwoArgFunction { DECL_OPERATION_PERFORM() };
 
 				/*! Pow function token.  First argument is the base, second the exponent. */
-				class Pow : public TwoArgFunction { };
+				class Pow : public TwoArgFunction { DECL_OPERATION_PERFORM() };
 
 
 		/*!	Three argument function token base class. */
@@ -152,3 +191,7 @@ class Function : public Operation { };
 		public:
 			virtual unsigned number_of_args() const override { return 3; }
 		};
+
+				/*! Conditional function token.  First argument is the condition, second the value when true, third the value when false.
+					The parser lowers if(c,a,b) to jumps so that only the selected branch is evaluated. */
+				class If : public ThreeArgFunction { DECL_OPERATION_PERFORM() };
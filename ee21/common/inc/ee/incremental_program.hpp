@@ -0,0 +1,89 @@
+#pragma once
+/*!	\file	incremental_program.hpp
+	\brief	IncrementalProgram class declaration.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A Program rebuilt as an expression tree whose nodes keep the
+value they last computed.  Re-evaluation only recomputes the
+nodes that read a variable set since that node was evaluated;
+every other sub-tree returns its cached value.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/operand.hpp>
+#include <ee/parser.hpp>
+#include <ee/variable.hpp>
+#include <cstddef>
+#include <vector>
+
+
+/*! Expression tree with per-node cached values, built from a compiled Program.
+	A node is dirty when one of the variables its sub-tree reads has a version newer than the
+	node's last evaluation.  Sub-trees containing Result are always recomputed because
+	their value depends on the evaluation history.  The target of an assignment is written,
+	not read, so it does not make the assignment dirty. */
+class IncrementalProgram {
+	/*! Expression tree node.  'token' is null for an if(c,a,b) node, whose children are c, a and b. */
+	struct Node {
+		Token::pointer_type			token;
+		std::vector<std::size_t>	children;
+		std::vector<Variable const*> reads;		// variables read anywhere in the sub-tree
+		bool						isVolatile = false;
+		Operand::pointer_type		value;
+		Variable::version_type		evaluated = 0;	// variable clock before the last evaluation
+	};
+
+	std::vector<Node>				nodes_m;
+	std::size_t						root_m = 0;
+	std::vector<Variable const*>	reads_m;
+	bool							isVolatile_m = false;
+	std::size_t						recomputed_m = 0;
+
+public:
+	explicit IncrementalProgram(Program const& program);
+
+	/*! Evaluates the program, recomputing only the dirty nodes. */
+	[[nodiscard]] Operand::pointer_type evaluate();
+
+	/*! The value of the last evaluate(), or null before the first. */
+	[[nodiscard]] Operand::pointer_type value() const { return nodes_m[root_m].value; }
+
+	/*! The variables the expression reads. */
+	[[nodiscard]] std::vector<Variable const*> const& reads() const { return reads_m; }
+
+	/*! True when the expression calls Result and so must be recomputed on every update. */
+	[[nodiscard]] bool is_volatile() const { return isVolatile_m; }
+
+	/*! True when a variable read by the expression changed since it was last evaluated. */
+	[[nodiscard]] bool is_dirty() const { return is_dirty(root_m); }
+
+	/*! Number of operations performed by the last evaluate(). */
+	[[nodiscard]] std::size_t recomputed() const { return recomputed_m; }
+
+private:
+	[[nodiscard]] std::size_t build(TokenList const& tokens, std::size_t begin, std::size_t end);
+	[[nodiscard]] std::size_t add_node(Token::pointer_type const& token, std::vector<std::size_t> children);
+	[[nodiscard]] bool is_dirty(std::size_t node) const;
+	[[nodiscard]] Operand::pointer_type evaluate(std::size_t node);
+};
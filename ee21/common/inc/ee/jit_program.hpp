@@ -0,0 +1,91 @@
+#pragma once
+/*!	\file	jit_program.hpp
+	\brief	JitProgram class declaration.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A Program that is promoted to x86-64 machine code when it is
+evaluated for the 'threshold'th time.
+
+Only integer arithmetic is compiled: Integer literals,
+variables, unary + and -, and + - * / %.  The native code works
+on 64-bit integers and checks every operation for overflow; when
+an input is not an Integer that fits in 64 bits, or a result
+would not, the evaluation falls back to the interpreter.  Every
+result is therefore identical to RPNEvaluator's, including its
+errors.  Programs using any other operation, and all programs
+on other processors, are always interpreted.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/evaluation_context.hpp>
+#include <ee/parser.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/variable.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+/*! Compiled program with an interpreter and, once hot, a native code path.
+	The evaluation count and the input buffer are per object, so give each thread its own. */
+class JitProgram {
+	JitProgram(JitProgram const&) = delete;
+	JitProgram& operator = (JitProgram const&) = delete;
+public:
+	static constexpr std::uint64_t DEFAULT_THRESHOLD = 1000;
+private:
+	struct Code;
+
+	Program						program_m;
+	RPNEvaluator				rpn_m;
+	std::unique_ptr<Code>		code_m;
+	std::vector<Variable const*>	inputs_m;		// variables read, in native input order
+	std::vector<std::int64_t>	arguments_m;	// native inputs of the current evaluation
+	std::uint64_t				threshold_m;
+	std::uint64_t				evaluations_m = 0;
+	bool						attempted_m = false;
+public:
+	/*! The program is compiled on its 'threshold'th evaluation; 0 compiles it immediately. */
+	explicit JitProgram(Program program, std::uint64_t threshold = DEFAULT_THRESHOLD);
+	~JitProgram();
+
+	/*! Evaluates the program like RPNEvaluator::evaluate(program, context), natively when it can. */
+	[[nodiscard]] Operand::pointer_type evaluate(EvaluationContext& context);
+
+	/*! True once the program has been compiled to native code. */
+	[[nodiscard]] bool is_compiled() const { return code_m != nullptr; }
+
+	/*! Number of evaluations so far. */
+	[[nodiscard]] std::uint64_t evaluations() const { return evaluations_m; }
+
+	[[nodiscard]] Program const& program() const { return program_m; }
+
+	/*! True when this build can generate native code. */
+	[[nodiscard]] static bool is_supported();
+
+private:
+	void compile();
+	[[nodiscard]] bool load_arguments();
+};
@@ -17,6 +17,10 @@ supporting utilities.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added DECL_OPERATION_PERFORM(), DEF_OPERATION_PERFORM() and Operation::perform().
+	Added ArgumentList so operations read their arguments in place on the evaluation stack.
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -51,6 +55,24 @@ the program(s) have been supplied.
 
 #include <ee/token.hpp>
 #include <ee/operand.hpp>
+#include <span>
+
+
+
+/*! View of an operation's arguments, ordered first argument to last. */
+using ArgumentList = std::span<Operand::pointer_type const>;
+
+
+
+/*! Declares the perform method of an operation.  Used inside a class declaration. */
+#define DECL_OPERATION_PERFORM()\
+	public: [[nodiscard]] Operand::pointer_type perform(ArgumentList args) const override;
+
+
+
+/*! Defines the perform method of an operation.  Used in the implementation file. */
+#define DEF_OPERATION_PERFORM(_TT)\
+	[[nodiscard]] Operand::pointer_type _TT::perform(ArgumentList args) const
 
 
 
@@ -60,4 +82,7 @@ public:
 	DEF_POINTER_TYPE(Operation)
 
 	[[nodiscard]] virtual unsigned number_of_args() const = 0;
+
+	/*! Performs the operation on 'args', ordered first argument to last. */
+	[[nodiscard]] virtual Operand::pointer_type perform(ArgumentList args) const = 0;
 };
\ No newline at end of file
@@ -46,6 +46,11 @@ supporting utilities.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Declared perform() on the concrete operators.
+	Added Factorial::max_argument and Factorial::parallel_threshold.
+	Added Power::max_result_bits.
+
 Version 2021.10.02
 	C++ 20 validated
 	Converted 'enum' to 'enum class'
@@ -87,6 +92,8 @@ the program(s) have been supplied.
 
 #include <ee/operand.hpp>
 #include <ee/operation.hpp>
+#include <atomic>
+#include <cstdint>
 
 
 /*! Operator Precedence values. */
@@ -120,14 +127,20 @@ public:
 				/*! Right-associative operator base class. */
 				class RAssocOperator : public BinaryOperator { };
 
-						/*! Power token. */
+						/*! Power token.
+							Integer powers whose result would need more than about 'max_result_bits' bits
+							are rejected before any multiplication is done. */
 						class Power : public RAssocOperator {
+						public:
+							static inline std::atomic<std::uint64_t> max_result_bits{ 1'000'000 };
 						DEF_PRECEDENCE(POWER)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Assignment token. */
 						class Assignment : public RAssocOperator {
 						DEF_PRECEDENCE(ASSIGNMENT)
+						DECL_OPERATION_PERFORM()
 						};
 
 
@@ -137,86 +150,103 @@ public:
 						/*! Addition token. */
 						class Addition : public LAssocOperator {
 						DEF_PRECEDENCE(ADDITIVE)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! And token. */
 						class And : public LAssocOperator {
 						DEF_PRECEDENCE(LOGAND)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Division token. */
 						class Division : public LAssocOperator {
 						DEF_PRECEDENCE(MULTIPLICATIVE)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Equality token. */
 						class Equality : public LAssocOperator {
 						DEF_PRECEDENCE(EQUALITY)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Greater than token. */
 						class Greater : public LAssocOperator {
 						DEF_PRECEDENCE(RELATIONAL)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Greater than or equal to token. */
 						class GreaterEqual : public LAssocOperator {
 						DEF_PRECEDENCE(RELATIONAL)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Inequality operator token. */
 						class Inequality : public LAssocOperator {
 						DEF_PRECEDENCE(EQUALITY)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Less than operator token. */
 						class Less : public LAssocOperator {
 						DEF_PRECEDENCE(RELATIONAL)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Less than equal-to operator token. */
 						class LessEqual : public LAssocOperator {
 						DEF_PRECEDENCE(RELATIONAL)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Multiplication operator token. */
 						class Multiplication : public LAssocOperator {
 						DEF_PRECEDENCE(MULTIPLICATIVE)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Modulus operator token. */
 						class Modulus : public LAssocOperator {
 						DEF_PRECEDENCE(MULTIPLICATIVE)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Nand operator token. */
 						class Nand : public LAssocOperator {
 						DEF_PRECEDENCE(LOGAND)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Nor operator token. */
 						class Nor : public LAssocOperator {
 						DEF_PRECEDENCE(LOGOR)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Or operator token. */
 						class Or : public LAssocOperator {
 						DEF_PRECEDENCE(LOGOR)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Subtraction operator token. */
 						class Subtraction : public LAssocOperator {
 						DEF_PRECEDENCE(ADDITIVE)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! XOR operator token. */
 						class Xor : public LAssocOperator {
 						DEF_PRECEDENCE(LOGOR)
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! XNOR operator token. */
 						class Xnor : public LAssocOperator {
 						DEF_PRECEDENCE(LOGOR)
+						DECL_OPERATION_PERFORM()
 						};
 
 
@@ -231,19 +261,29 @@ public:
 
 						/*! Identity operator token. */
 						class Identity : public UnaryOperator {
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Negation operator token. */
 						class Negation : public UnaryOperator {
+						DECL_OPERATION_PERFORM()
 						};
 
 						/*! Not operator token. */
 						class Not : public UnaryOperator {
+						DECL_OPERATION_PERFORM()
 						};
 
 				/*! Postfix Operator token base class. */
 				class PostfixOperator : public UnaryOperator { };
 
-						/*! Factorial token base class. */
+						/*! Factorial token base class.
+							Arguments above 'max_argument' are rejected before any multiplication is done.
+							Arguments of at least 'parallel_threshold' (0 = never) multiply their partial
+							products on up to hardware_concurrency() threads. */
 						class Factorial : public PostfixOperator {
+						public:
+							static inline std::atomic<std::uint64_t> max_argument{ 100'000 };
+							static inline std::atomic<std::uint64_t> parallel_threshold{ 5'000 };
+						DECL_OPERATION_PERFORM()
 						};
@@ -10,6 +10,10 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added Program and Parser::compile(); stack depth is computed at parse time.
+	Added parse() with token origins.
+
 Version 2021.11.01
 	C++ 20 validated
 	Changed to GATS_TEST
@@ -37,6 +41,21 @@ stipulated in the agreement/contract under which
 the program(s) have been supplied.
 =============================================================*/
 #include <ee/token.hpp>
+#include <cstddef>
+#include <vector>
+
+
+/*! A validated postfix token list and the evaluation stack depth it requires.
+	Construction rejects malformed lists, so evaluation never checks for missing operands. */
+class Program {
+	TokenList	tokens_m;
+	std::size_t	stackDepth_m = 0;
+public:
+	explicit Program(TokenList postfixTokens);
+	[[nodiscard]] TokenList const&	tokens() const { return tokens_m; }
+	[[nodiscard]] std::size_t		stack_depth() const { return stackDepth_m; }
+};
+
 
 class Parser {
 	Parser(Parser const&) = delete;
@@ -44,4 +63,11 @@ class Parser {
 public:
 	Parser() = default;
 	[[nodiscard]] TokenList parse(TokenList const& infixTokens);
+
+	/*! Parses 'infixTokens', replacing 'origins' with the index in 'infixTokens' of the token each
+		postfix token came from.  The jumps of an if(c,a,b) come from its 'if' token. */
+	[[nodiscard]] TokenList parse(TokenList const& infixTokens, std::vector<std::size_t>& origins);
+	[[nodiscard]] Program compile(TokenList const& infixTokens) { return Program(parse(infixTokens)); }
+private:
+	[[nodiscard]] TokenList _parse(TokenList const& infixTokens, std::vector<std::size_t>* origins);
 };
@@ -0,0 +1,101 @@
+#pragma once
+/*!	\file	profile.hpp
+	\brief	Profile class declaration.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A counting profiler for one expression.  RPNEvaluator times
+each Operation it performs for a Profile and attributes the
+call to a site: the operation together with the source text of
+its sub-expression, such as 'Sin: sin(x / 2)'.  An if(c,a,b)
+is a site of its own, whose children are the sites of its
+arguments.
+
+The measurements are available per site, per Operation class
+(Power, Sqrt, Arctan2, ...), and as folded stacks, one line per
+site holding the path of sites from the root and the site's own
+time in nanoseconds, which flamegraph.pl and speedscope read.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/parser.hpp>
+#include <ee/tokenizer.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+class Profile {
+public:
+	using duration = std::chrono::nanoseconds;
+
+	struct Counter {
+		std::uint64_t	calls = 0;
+		duration		time{};
+	};
+
+	/*! An operation, or an if(c,a,b), of the expression. */
+	struct Site {
+		std::string		operation;		// class name of the operation, or "If"
+		std::string		source;			// text of the sub-expression
+		std::size_t		parent;			// index of the enclosing site, or NO_PARENT
+		Counter			counter;		// time spent in the operation itself
+	};
+
+	static constexpr std::size_t NO_PARENT = std::numeric_limits<std::size_t>::max();
+private:
+	Program						program_m;
+	std::vector<Site>			sites_m;
+	std::vector<std::size_t>	siteOf_m;		// postfix token -> site, or NO_PARENT
+public:
+	/*! Profile of 'program', compiled from 'expression' with Tokenizer::tokenize(expression, spans)
+		and Parser::parse(infixTokens, origins). */
+	Profile(std::string const& expression, TokenList const& infixTokens, std::vector<SourceSpan> const& spans,
+		Program program, std::vector<std::size_t> const& origins);
+
+	[[nodiscard]] Program const& program() const { return program_m; }
+
+	/*! The sites, each after the sites it encloses; the root is last. */
+	[[nodiscard]] std::vector<Site> const& sites() const { return sites_m; }
+
+	/*! Adds a call of the operation at postfix token 'token' lasting 'elapsed'. */
+	void record(std::size_t token, duration elapsed) {
+		auto& counter = sites_m[siteOf_m[token]].counter;
+		++counter.calls;
+		counter.time += elapsed;
+	}
+
+	/*! The counters of the sites added up by operation class. */
+	[[nodiscard]] std::map<std::string, Counter> by_operation() const;
+
+	/*! Writes one 'root;...;site nanoseconds' line for each site that took time. */
+	void write_folded(std::ostream& os) const;
+};
+
+/*! Writes the operation classes, then the sites, by decreasing time. */
+std::ostream& operator << (std::ostream& os, Profile const& profile);
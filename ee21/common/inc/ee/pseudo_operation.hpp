@@ -13,11 +13,16 @@ Declarations of the PseudoOperation classes derived from Token.
 			class LeftParenthesis
 			class RightParenthesis
 		class ArgumentSeparator
+		class Jump
+			class JumpIfFalse
 
 =============================================================
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added Jump and JumpIfFalse for lazily evaluated conditionals.
+
 Version 2021.10.26
 	C++ 20 validated
 
@@ -60,3 +65,19 @@ class PseudoOperation : public Token { };
 
 		/*! Argument-separator operation token. */
 		class ArgumentSeparator : public PseudoOperation { };
+
+		/*! Jump pseudo-operation token.  Evaluation continues at the postfix index 'target()'. */
+		class Jump : public PseudoOperation {
+			std::size_t target_m = 0;
+		public:
+			DEF_POINTER_TYPE(Jump)
+			[[nodiscard]] std::size_t target() const { return target_m; }
+			void set_target(std::size_t target) { target_m = target; }
+			[[nodiscard]] string_type str() const override { return "<Jump:" + std::to_string(target_m) + ">"; }
+		};
+
+				/*! Conditional jump token.  Consumes a Boolean and jumps only when it is false. */
+				class JumpIfFalse : public Jump {
+				public:
+					[[nodiscard]] string_type str() const override { return "<JumpIfFalse:" + std::to_string(target()) + ">"; }
+				};
@@ -14,6 +14,10 @@ the subclasses Pi and E.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added real_value_of().
+	Constructor takes value_type by const reference.
+
 Version 2021.10.26
 	C++ 20 validated
 
@@ -60,12 +64,16 @@ public:
 private:
 	value_type	value_;
 public:
-	Real(value_type value = value_type(0)) : value_(value) { }
+	Real(value_type const& value = value_type(0)) : value_(value) { }
 	[[nodiscard]] value_type	value() const { return value_; };
 	[[nodiscard]] string_type	str() const override;
 };
 
 
+/*! Gets the value of an Integer or Real operand as a real number. */
+[[nodiscard]] Real::value_type real_value_of(Operand::pointer_type const& operand);
+
+
 /*! Pi constant token. */
 class Pi : public Real {
 public:
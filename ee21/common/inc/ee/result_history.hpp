@@ -0,0 +1,94 @@
+#pragma once
+/*!	\file	result_history.hpp
+	\brief	ResultHistory class declaration.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+The results read by the Result function, numbered from 1 in
+the order they were added.  The most recent depth() results are
+kept in a fixed ring, so memory stays flat however many results
+are added and a lookup is an index calculation.
+
+Results that fall out of the ring are discarded unless
+spill_to() has been called; from then on they are appended to a
+data file in the compact form of write_operand(), with their
+offsets in a fixed-width index file, so looking up a spilled
+result is two seeks and one read_operand().
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/operand.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+
+/*! Bounded history of evaluation results. */
+class ResultHistory {
+public:
+	using index_type = std::uint64_t;
+	static constexpr std::size_t DEFAULT_DEPTH = 1024;
+private:
+	struct Spill;
+
+	std::vector<Operand::pointer_type>	ring_m;			// result i is held at (i - 1) % depth()
+	index_type							count_m = 0;	// results added
+	std::size_t							held_m = 0;		// results in the ring: the last held_m added
+	std::unique_ptr<Spill>				spill_m;
+public:
+	/*! Keeps the most recent 'depth' results in memory; at least one. */
+	explicit ResultHistory(std::size_t depth = DEFAULT_DEPTH);
+	/*! Copies the results in memory; the copy does not share the spill files. */
+	ResultHistory(ResultHistory const& other);
+	ResultHistory(ResultHistory&& other) noexcept;
+	ResultHistory& operator = (ResultHistory const& other);
+	ResultHistory& operator = (ResultHistory&& other) noexcept;
+	~ResultHistory();
+
+	/*! Number of results added. */
+	[[nodiscard]] index_type size() const { return count_m; }
+
+	/*! Number of results kept in memory. */
+	[[nodiscard]] std::size_t depth() const { return ring_m.size(); }
+
+	/*! Changes the number of results kept in memory, spilling or discarding the oldest ones if it shrinks. */
+	void set_depth(std::size_t depth);
+
+	/*! Spills results that leave the ring to 'path' and 'path'.index from now on.
+		The files are replaced if they exist and removed when the history is destroyed.
+		@throws std::runtime_error if the files cannot be created. */
+	void spill_to(std::filesystem::path const& path);
+
+	[[nodiscard]] bool is_spilling() const { return spill_m != nullptr; }
+
+	void add(Operand::pointer_type const& result);
+
+	/*! The 1-based 'index'th result.
+		@throws std::runtime_error if there is no such result or it has been discarded. */
+	[[nodiscard]] Operand::pointer_type operator [] (index_type index) const;
+
+private:
+	void evict(index_type index);
+};
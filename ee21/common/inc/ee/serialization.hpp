@@ -0,0 +1,67 @@
+#pragma once
+/*!	\file	serialization.hpp
+	\brief	Binary operand serialization declarations.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Operands written as a one-byte type tag followed by the value
+in its native binary form: an Integer as its sign and magnitude
+bytes, a Real as the limbs, exponent and flags of its
+cpp_dec_float backend, a Boolean as one byte.  A variable is
+written as the value it holds.
+
+Compiled programs have a versioned format of fixed-size token
+records followed by a variable name table and a pool of
+literals in the same native form, so loading a program copies
+literals instead of parsing decimal text, and the bytes can be
+read in place from a memory-mapped file.  Both encodings use
+the host byte order and Real precision, which the program
+header records and read_program() checks.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Added the binary program format.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/operand.hpp>
+#include <ee/parser.hpp>
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <span>
+
+
+/*! Writes 'operand' to the binary stream 'os'.
+	@throws std::runtime_error if the operand cannot be serialized. */
+void write_operand(std::ostream& os, Operand::pointer_type const& operand);
+
+/*! Reads an operand written by write_operand().
+	@throws std::runtime_error if the stream is truncated or holds an unknown tag. */
+[[nodiscard]] Operand::pointer_type read_operand(std::istream& is);
+
+/*! Writes 'program' in the binary program format; 'variable_name' names each variable slot it uses.
+	@throws std::runtime_error if the program holds a token that cannot be serialized. */
+void write_program(std::ostream& os, Program const& program, std::function<Token::string_type(std::size_t slot)> const& variable_name);
+
+/*! Rebuilds a program from 'bytes' written by write_program(); 'variable' supplies the token for each variable name.
+	@throws std::runtime_error if the bytes are not a valid program of this format version. */
+[[nodiscard]] Program read_program(std::span<std::byte const> bytes, std::function<Token::pointer_type(Token::string_type const& name)> const& variable);
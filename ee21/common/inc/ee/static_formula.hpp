@@ -0,0 +1,511 @@
+#pragma once
+/*!	\file	static_formula.hpp
+	\brief	StaticFormula class template declaration and implementation.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Compile-time front end for formulas known when the program is
+built.  A string literal is tokenized and parsed by constexpr
+mirrors of Tokenizer::tokenize and Parser::parse, and each node
+of the parse becomes its own type, StaticNode, whose evaluate()
+is the node's arithmetic on its children.  The compiler inlines
+the whole tree, so evaluating a static formula costs what the
+equivalent hand-written arithmetic costs:
+
+	using Hypotenuse = StaticFormula<"(a ** 2 + b ** 2) ** 0.5", std::int64_t, double>;
+	double c = Hypotenuse::evaluate(3, 4);
+
+Supported: decimal Integer and Real literals, variables, pi, e,
+unary + and -, + - * / % mod and **, and parentheses, with the
+runtime precedence and associativity.  Errors in the text are
+compile-time errors.  Variables are the arguments of evaluate(),
+in order of their first appearance.
+
+The operations follow operator.cpp: Integer operands stay
+Integer, mixed operands are promoted to Real, Integer / and %
+truncate and throw on a zero divisor, Real % is fmod, and Integer
+powers are limited by Power::max_result_bits.  Because the result
+type is fixed at compile time, an Integer raised to a negative
+Integer power throws instead of returning a Real.  Identifiers are
+letters and digits, as for Tokenizer.  With a built-in REAL type,
+every Real literal must be exactly representable as a double.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Identifiers match the tokenizer; Integer powers follow Power::max_result_bits;
+	Real literals must be exact doubles for a built-in REAL.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/integer.hpp>
+#include <ee/operator.hpp>
+#include <ee/real.hpp>
+#include <ee/transcendental.hpp>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+
+/*! A string literal usable as a template argument. */
+template <std::size_t N>
+struct FormulaText {
+	char text[N] = {};
+	constexpr FormulaText(char const (&literal)[N]) {
+		for (std::size_t i = 0; i < N; ++i)
+			text[i] = literal[i];
+	}
+	[[nodiscard]] constexpr std::string_view view() const { return std::string_view(text, N - 1); }
+};
+
+
+
+/*! Node kinds of a static formula; the operator kinds are listed in increasing precedence. */
+enum class StaticKind : unsigned char {
+	Integer, Real, Variable, Pi, E,
+	Addition, Subtraction, Multiplication, Division, Modulus,
+	Identity, Negation, Power,
+	LeftParenthesis, RightParenthesis
+};
+
+/*! A token of a static formula, and after parsing a node of its tree. */
+struct StaticToken {
+	StaticKind			kind = StaticKind::Integer;
+	std::string_view	text;				// literal or variable spelling
+	long long			integer = 0;		// Integer literal, if it fits
+	double				real = 0.0;			// Real literal, rounded to double
+	bool				fitsBuiltin = true;	// the literal is exact in 'integer' / 'real'
+	std::size_t			variable = 0;		// argument index of a variable
+	std::size_t			left = 0, right = 0;	// operand nodes of an operator
+};
+
+/*! The parsed formula: nodes in postfix order, the last one the root. */
+template <std::size_t N>
+struct StaticProgram {
+	std::array<StaticToken, N>		nodes{};
+	std::size_t						size = 0;
+	std::array<std::string_view, N>	names{};
+	std::size_t						arity = 0;
+};
+
+
+
+namespace static_formula_detail {
+	[[nodiscard]] constexpr bool is_digit(char c) { return c >= '0' && c <= '9'; }
+	[[nodiscard]] constexpr bool is_alpha(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+
+	[[nodiscard]] constexpr bool is_operator(StaticKind kind) { return kind >= StaticKind::Addition && kind <= StaticKind::Power; }
+	[[nodiscard]] constexpr bool is_unary(StaticKind kind) { return kind == StaticKind::Identity || kind == StaticKind::Negation; }
+
+	[[nodiscard]] constexpr int precedence(StaticKind kind) {
+		switch (kind) {
+		case StaticKind::Addition: case StaticKind::Subtraction: return 1;
+		case StaticKind::Identity: case StaticKind::Negation: return 3;
+		case StaticKind::Power: return 4;
+		default: return 2;
+		}
+	}
+
+	/*! Decimal literal 'text' as a double; correctly rounded when it has at most 15 significant digits.
+		'exact' is set when the double is exactly the literal's value. */
+	[[nodiscard]] constexpr double to_double(std::string_view text, bool& exact) {
+		unsigned long long mantissa = 0;
+		int scale = 0, digits = 0;
+		bool dropped = false;				// a non-zero digit past the 18th
+		std::size_t i = 0;
+		for (bool fraction = false; i < text.size() && (is_digit(text[i]) || text[i] == '.'); ++i) {
+			if (text[i] == '.') { fraction = true; continue; }
+			if (digits < 18) {
+				mantissa = mantissa * 10 + unsigned(text[i] - '0');
+				digits += mantissa != 0;
+				scale -= fraction;
+			}
+			else {
+				scale += !fraction;
+				dropped |= text[i] != '0';
+			}
+		}
+		if (i < text.size()) {
+			int sign = 1, exponent = 0;
+			if (text[++i] == '+' || text[i] == '-')
+				sign = text[i++] == '-' ? -1 : 1;
+			for (; i < text.size(); ++i)
+				exponent = exponent * 10 + (text[i] - '0');
+			scale += sign * exponent;
+		}
+		while (mantissa != 0 && mantissa % 10 == 0) {
+			mantissa /= 10;
+			++scale;
+		}
+
+		// exact when mantissa 10^scale is an odd number below 2^53 times a power of two, and
+		// mantissa and 10^|scale| are exact doubles, so the one rounding below is exact too
+		constexpr unsigned long long LIMIT = 1ull << 53;
+		auto odd = mantissa;
+		bool representable = true;
+		while (odd != 0 && odd % 2 == 0)
+			odd /= 2;
+		for (int s = scale; s < 0; ++s)
+			if (odd % 5 == 0)
+				odd /= 5;
+			else
+				representable = false;
+		for (int s = scale; s > 0 && odd < LIMIT; --s)
+			odd *= 5;
+		exact = !dropped && representable && odd < LIMIT && mantissa < LIMIT && scale >= -22 && scale <= 22;
+
+		double value = double(mantissa), power = 1.0;
+		for (int s = scale < 0 ? -scale : scale; s > 0; --s)
+			power *= 10.0;
+		return scale < 0 ? value / power : value * power;
+	}
+
+	/*! Mirrors Tokenizer::tokenize for the static subset. */
+	template <std::size_t N>
+	[[nodiscard]] constexpr StaticProgram<N> tokenize(std::string_view text) {
+		StaticProgram<N> tokens;
+		auto previousIsOperand = [&] {
+			if (tokens.size == 0)
+				return false;
+			auto const kind = tokens.nodes[tokens.size - 1].kind;
+			return !is_operator(kind) && kind != StaticKind::LeftParenthesis;
+		};
+		auto add = [&](StaticToken token) {
+			bool const operand = !is_operator(token.kind) && token.kind != StaticKind::LeftParenthesis && token.kind != StaticKind::RightParenthesis;
+			if ((operand || token.kind == StaticKind::LeftParenthesis) && previousIsOperand())
+				throw std::runtime_error("Error: missing operator");
+			tokens.nodes[tokens.size++] = token;
+		};
+
+		for (std::size_t i = 0; i < text.size(); ) {
+			char const c = text[i];
+			if (c == ' ' || c == '\t') { ++i; continue; }
+			StaticToken token;
+			if (is_digit(c)) {
+				auto const first = i;
+				bool isReal = false;
+				while (i < text.size() && (is_digit(text[i]) || text[i] == '.'))
+					isReal |= text[i++] == '.';
+				if (i < text.size() && (text[i] == 'e' || text[i] == 'E')) {
+					isReal = true;
+					if (++i < text.size() && (text[i] == '+' || text[i] == '-'))
+						++i;
+					if (i == text.size() || !is_digit(text[i]))
+						throw std::runtime_error("Error: malformed exponent");
+					while (i < text.size() && is_digit(text[i]))
+						++i;
+				}
+				token.text = text.substr(first, i - first);
+				if (isReal) {
+					token.kind = StaticKind::Real;
+					token.real = to_double(token.text, token.fitsBuiltin);
+				}
+				else {
+					for (char d : token.text) {
+						if (token.integer > (std::numeric_limits<long long>::max() - (d - '0')) / 10)
+							token.fitsBuiltin = false;
+						else
+							token.integer = token.integer * 10 + (d - '0');
+					}
+				}
+				add(token);
+				continue;
+			}
+			if (is_alpha(c)) {
+				auto const first = i;
+				while (i < text.size() && (is_alpha(text[i]) || is_digit(text[i])))
+					++i;
+				token.text = text.substr(first, i - first);
+				if (token.text == "mod" || token.text == "Mod" || token.text == "MOD")
+					token.kind = StaticKind::Modulus;
+				else if (token.text == "pi" || token.text == "Pi" || token.text == "PI")
+					token.kind = StaticKind::Pi;
+				else if (token.text == "e" || token.text == "E")
+					token.kind = StaticKind::E;
+				else {
+					token.kind = StaticKind::Variable;
+					while (token.variable < tokens.arity && tokens.names[token.variable] != token.text)
+						++token.variable;
+					if (token.variable == tokens.arity)
+						tokens.names[tokens.arity++] = token.text;
+				}
+				add(token);
+				continue;
+			}
+			switch (c) {
+			case '+': token.kind = previousIsOperand() ? StaticKind::Addition : StaticKind::Identity; break;
+			case '-': token.kind = previousIsOperand() ? StaticKind::Subtraction : StaticKind::Negation; break;
+			case '*':
+				token.kind = StaticKind::Multiplication;
+				if (i + 1 < text.size() && text[i + 1] == '*') {
+					token.kind = StaticKind::Power;
+					++i;
+				}
+				break;
+			case '/': token.kind = StaticKind::Division; break;
+			case '%': token.kind = StaticKind::Modulus; break;
+			case '(': token.kind = StaticKind::LeftParenthesis; break;
+			case ')': token.kind = StaticKind::RightParenthesis; break;
+			default: throw std::runtime_error("Error: character not supported in a static formula");
+			}
+			++i;
+			add(token);
+		}
+		return tokens;
+	}
+
+	/*! Mirrors Parser::parse, then links each operator to its operand nodes. */
+	template <std::size_t N>
+	[[nodiscard]] constexpr StaticProgram<N> parse(std::string_view text) {
+		auto const infix = tokenize<N>(text);
+		StaticProgram<N> postfix;
+		postfix.names = infix.names;
+		postfix.arity = infix.arity;
+
+		std::array<StaticToken, N> operators{};
+		std::size_t top = 0;
+		for (std::size_t i = 0; i < infix.size; ++i) {
+			auto const& token = infix.nodes[i];
+			if (token.kind == StaticKind::LeftParenthesis)
+				operators[top++] = token;
+			else if (token.kind == StaticKind::RightParenthesis) {
+				while (top > 0 && operators[top - 1].kind != StaticKind::LeftParenthesis)
+					postfix.nodes[postfix.size++] = operators[--top];
+				if (top == 0)
+					throw std::runtime_error("Error: right parenthesis has no matching left parenthesis");
+				--top;
+			}
+			else if (is_operator(token.kind)) {
+				// unary operators are non-associative; ** is right-associative
+				while (!is_unary(token.kind) && top > 0 && is_operator(operators[top - 1].kind)) {
+					auto const stacked = precedence(operators[top - 1].kind), current = precedence(token.kind);
+					if (current > stacked || (token.kind == StaticKind::Power && current >= stacked))
+						break;
+					postfix.nodes[postfix.size++] = operators[--top];
+				}
+				operators[top++] = token;
+			}
+			else
+				postfix.nodes[postfix.size++] = token;
+		}
+		while (top > 0) {
+			if (operators[top - 1].kind == StaticKind::LeftParenthesis)
+				throw std::runtime_error("Error: missing right parenthesis");
+			postfix.nodes[postfix.size++] = operators[--top];
+		}
+
+		std::array<std::size_t, N> operands{};
+		std::size_t depth = 0;
+		for (std::size_t i = 0; i < postfix.size; ++i) {
+			auto& node = postfix.nodes[i];
+			std::size_t const arguments = is_unary(node.kind) ? 1 : is_operator(node.kind) ? 2 : 0;
+			if (depth < arguments)
+				throw std::runtime_error("Error: insufficient operands");
+			if (arguments == 2)
+				node.left = operands[depth - 2];
+			if (arguments > 0)
+				node.right = operands[depth - 1];
+			depth -= arguments;
+			operands[depth++] = i;
+		}
+		if (depth != 1)
+			throw std::runtime_error(depth == 0 ? "Error: empty formula" : "Error: too many operands");
+		return postfix;
+	}
+
+
+
+	template <typename T>
+	inline constexpr bool is_integer_v = std::is_integral_v<T> ||
+		boost::multiprecision::number_category<T>::value == boost::multiprecision::number_kind_integer;
+
+	/*! The type of a binary operation: Integer stays Integer, anything mixed is Real. */
+	template <typename L, typename R, typename INTEGER, typename REAL>
+	using promoted_t = std::conditional_t<std::is_same_v<L, R>, L,
+		std::conditional_t<is_integer_v<L> && is_integer_v<R>, INTEGER, REAL>>;
+
+	/*! Integer power by square-and-multiply.  As in operator.cpp, bases 0, 1, and -1 accept exponents
+		of any size; other results are limited to Power::max_result_bits, estimated as the bits of the
+		base times the exponent. */
+	template <typename T>
+	[[nodiscard]] T integer_power(T base, T exponent) {
+		if (exponent < 0)
+			throw std::runtime_error("Error: negative exponent of an integer in a static formula");
+		if (base == 0)
+			return exponent == 0 ? T(1) : T(0);
+		if (base == 1)
+			return T(1);
+		if (base == -1)
+			return exponent % 2 != 0 ? T(-1) : T(1);
+
+		// halving towards zero counts the bits without negating, which could overflow a built-in type
+		std::uint64_t bits = 0;
+		bool powerOfTwo = true;
+		for (T m = base; m != 0; m /= 2) {
+			++bits;
+			powerOfTwo &= m % 2 == 0 || m / 2 == 0;
+		}
+		std::uint64_t const maxExponent = Power::max_result_bits.load() / (powerOfTwo ? bits - 1 : bits);
+		bool tooLarge = false;
+		if constexpr (std::is_integral_v<T>)
+			tooLarge = static_cast<std::uint64_t>(exponent) > maxExponent;
+		else
+			tooLarge = exponent > maxExponent;
+		if (tooLarge)
+			throw std::runtime_error("Error: power result too large");
+
+		T result = 1;
+		while (exponent != 0) {
+			if (exponent % 2 != 0)
+				result *= base;
+			exponent /= 2;
+			if (exponent != 0)
+				base *= base;
+		}
+		return result;
+	}
+
+	template <typename L, typename R, typename INTEGER, typename REAL>
+	[[nodiscard]] auto power(L const& base, R const& exponent) {
+		using result_type = promoted_t<L, R, INTEGER, REAL>;
+		if constexpr (is_integer_v<L> && is_integer_v<R>)
+			return integer_power<result_type>(result_type(base), result_type(exponent));
+		else if constexpr (std::is_floating_point_v<REAL>)
+			return REAL(std::pow(REAL(base), REAL(exponent)));
+		else if constexpr (is_integer_v<R>) {
+			// Real base: boost's integer pow() squares without the exp/log of the real pow(), as in operator.cpp
+			using boost::multiprecision::pow;
+			return REAL(pow(REAL(base), static_cast<long long>(exponent)));
+		}
+		else
+			return REAL(transcendental::pow(REAL(base), REAL(exponent)));
+	}
+
+	template <typename L, typename R, typename INTEGER, typename REAL>
+	[[nodiscard]] auto binary(StaticKind kind, L const& lhs, R const& rhs) {
+		using result_type = promoted_t<L, R, INTEGER, REAL>;
+		result_type const l(lhs), r(rhs);
+		switch (kind) {
+		case StaticKind::Addition:			return result_type(l + r);
+		case StaticKind::Subtraction:		return result_type(l - r);
+		case StaticKind::Multiplication:	return result_type(l * r);
+		case StaticKind::Division:
+			if constexpr (is_integer_v<result_type>)
+				if (r == 0)
+					throw std::runtime_error("Error: division by zero");
+			return result_type(l / r);
+		default:
+			if constexpr (is_integer_v<result_type>) {
+				if (r == 0)
+					throw std::runtime_error("Error: division by zero");
+				return result_type(l % r);
+			}
+			else {
+				using std::fmod;
+				return result_type(fmod(l, r));
+			}
+		}
+	}
+}
+
+
+
+/*! Node I of the static formula TEXT; the expression template type of its sub-tree. */
+template <FormulaText TEXT, std::size_t I, typename INTEGER, typename REAL>
+struct StaticNode {
+	static constexpr auto program = static_formula_detail::parse<sizeof(TEXT.text)>(TEXT.view());
+	static constexpr StaticToken node = program.nodes[I];
+
+	template <typename ARGUMENTS>
+	[[nodiscard]] static auto evaluate([[maybe_unused]] ARGUMENTS const& arguments) {
+		using namespace static_formula_detail;
+		using Left = StaticNode<TEXT, node.left, INTEGER, REAL>;
+		using Right = StaticNode<TEXT, node.right, INTEGER, REAL>;
+		if constexpr (node.kind == StaticKind::Integer) {
+			if constexpr (std::is_arithmetic_v<INTEGER>) {
+				static_assert(node.fitsBuiltin, "integer literal does not fit the formula's integer type");
+				return INTEGER(node.integer);
+			}
+			else {
+				static INTEGER const value(std::string(node.text).c_str());
+				return value;
+			}
+		}
+		else if constexpr (node.kind == StaticKind::Real) {
+			if constexpr (std::is_floating_point_v<REAL>) {
+				static_assert(node.fitsBuiltin, "real literal is not exactly representable in the formula's real type");
+				return REAL(node.real);
+			}
+			else {
+				static REAL const value(std::string(node.text).c_str());
+				return value;
+			}
+		}
+		else if constexpr (node.kind == StaticKind::Pi)
+			return boost::math::constants::pi<REAL>();
+		else if constexpr (node.kind == StaticKind::E)
+			return boost::math::constants::e<REAL>();
+		else if constexpr (node.kind == StaticKind::Variable)
+			return std::get<node.variable>(arguments);
+		else if constexpr (node.kind == StaticKind::Identity)
+			return Right::evaluate(arguments);
+		else if constexpr (node.kind == StaticKind::Negation) {
+			auto value = Right::evaluate(arguments);
+			return decltype(value)(-value);
+		}
+		else if constexpr (node.kind == StaticKind::Power)
+			return power<decltype(Left::evaluate(arguments)), decltype(Right::evaluate(arguments)), INTEGER, REAL>(Left::evaluate(arguments), Right::evaluate(arguments));
+		else
+			return binary<decltype(Left::evaluate(arguments)), decltype(Right::evaluate(arguments)), INTEGER, REAL>(node.kind, Left::evaluate(arguments), Right::evaluate(arguments));
+	}
+};
+
+
+
+/*! A formula parsed at compile time.  INTEGER and REAL are the types of its Integer and Real
+	literals and of mixed results: the interpreter's by default, or e.g. std::int64_t and double. */
+template <FormulaText TEXT, typename INTEGER = Integer::value_type, typename REAL = Real::value_type>
+class StaticFormula {
+	static constexpr auto program = static_formula_detail::parse<sizeof(TEXT.text)>(TEXT.view());
+public:
+	using root_type = StaticNode<TEXT, program.size - 1, INTEGER, REAL>;
+
+	/*! Number of variables, which are the arguments of evaluate(). */
+	static constexpr std::size_t arity = program.arity;
+
+	/*! The variable names, in argument order. */
+	[[nodiscard]] static constexpr std::string_view name(std::size_t index) { return program.names[index]; }
+
+	/*! Evaluates the formula with 'arguments' as its variables, in order of first appearance. */
+	template <typename... ARGUMENTS>
+	[[nodiscard]] static auto evaluate(ARGUMENTS const&... arguments) {
+		static_assert(sizeof...(ARGUMENTS) == arity, "wrong number of arguments for the formula's variables");
+		return root_type::evaluate(std::forward_as_tuple(arguments...));
+	}
+
+	template <typename... ARGUMENTS>
+	[[nodiscard]] auto operator () (ARGUMENTS const&... arguments) const { return evaluate(arguments...); }
+};
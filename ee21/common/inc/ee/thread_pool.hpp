@@ -0,0 +1,105 @@
+#pragma once
+/*!	\file	thread_pool.hpp
+	\brief	ThreadPool class declaration and implementation.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A fixed set of worker threads that run submitted tasks in
+FIFO order.  submit() returns a std::future that carries the
+task's exception, if any, back to the caller.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+/*! Fixed-size pool of worker threads. */
+class ThreadPool {
+	ThreadPool(ThreadPool const&) = delete;
+	ThreadPool& operator = (ThreadPool const&) = delete;
+
+	std::vector<std::thread>			workers_m;
+	std::queue<std::function<void()>>	tasks_m;
+	std::mutex							guard_m;
+	std::condition_variable				ready_m;
+	bool								stopping_m = false;
+
+public:
+	/*! Starts 'threads' workers; at least one. */
+	explicit ThreadPool(unsigned threads) {
+		threads = threads == 0 ? 1 : threads;
+		workers_m.reserve(threads);
+		for (unsigned i = 0; i < threads; ++i)
+			workers_m.emplace_back([this] { run(); });
+	}
+
+	/*! Finishes the queued tasks, then joins the workers. */
+	~ThreadPool() {
+		{
+			std::lock_guard lock(guard_m);
+			stopping_m = true;
+		}
+		ready_m.notify_all();
+		for (auto& worker : workers_m)
+			worker.join();
+	}
+
+	[[nodiscard]] unsigned size() const { return unsigned(workers_m.size()); }
+
+	/*! Queues 'task'; the future becomes ready when it has run. */
+	template <typename TASK>
+	[[nodiscard]] std::future<void> submit(TASK task) {
+		auto packaged = std::make_shared<std::packaged_task<void()>>(std::move(task));
+		auto result = packaged->get_future();
+		{
+			std::lock_guard lock(guard_m);
+			tasks_m.emplace([packaged] { (*packaged)(); });
+		}
+		ready_m.notify_one();
+		return result;
+	}
+
+private:
+	void run() {
+		for (;;) {
+			std::function<void()> task;
+			{
+				std::unique_lock lock(guard_m);
+				ready_m.wait(lock, [this] { return stopping_m || !tasks_m.empty(); });
+				if (tasks_m.empty())
+					return;
+				task = std::move(tasks_m.front());
+				tasks_m.pop();
+			}
+			task();
+		}
+	}
+};
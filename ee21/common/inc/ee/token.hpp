@@ -12,6 +12,9 @@ Declarations of the Token class.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added per-thread allocation counting.
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -44,6 +47,8 @@ stipulated in the agreement/contract under which
 the program(s) have been supplied.
 =============================================================*/
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <utility>
 #include <string>
@@ -60,6 +65,7 @@ the program(s) have been supplied.
 
 /*! Token base class. */
 class Token {
+	static inline thread_local std::uint64_t allocations_m = 0;
 public:
 	DEF_POINTER_TYPE(Token)
 	using string_type = std::string;
@@ -71,6 +77,13 @@ public:
 	constexpr Token() = default;
 	virtual ~Token() = default;
 	[[nodiscard]] virtual string_type str() const;
+
+	/*! Tokens are allocated through these, so the calling thread's allocations are counted. */
+	[[nodiscard]] static void* operator new(std::size_t size) { ++allocations_m; return ::operator new(size); }
+	static void operator delete(void* token) noexcept { ::operator delete(token); }
+
+	/*! Number of Tokens allocated by the calling thread. */
+	[[nodiscard]] static std::uint64_t allocations() { return allocations_m; }
 };
 
 
@@ -9,6 +9,12 @@
 Revision History
 ------------------------------------------------------------ -
 
+Version 2026.10.19
+	Added add_keyword().
+	Variables are numbered with dense slots of the tokenizer's EvaluationContext.
+	Added variable() and variable_name().
+	Added tokenize() with source spans.
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -56,8 +62,20 @@ the program(s) have been supplied.
 ============================================================= */
 
 #include <ee/token.hpp>
+#include <ee/evaluation_context.hpp>
+#include <cstddef>
+#include <memory>
 #include <map>
 #include <string>
+#include <vector>
+
+
+/*! Offsets [first, last) of a token in its expression. */
+struct SourceSpan {
+	std::size_t	first = 0;
+	std::size_t	last = 0;
+};
+
 
 
 /*! Tokenizer class is used to create lists of tokens from expression strings.
@@ -108,14 +126,34 @@ private:
 private:
 	dictionary_type	keywords_m;
 	dictionary_type variables_m;
+	std::vector<string_type>			variableNames_m;	// by slot
+	std::shared_ptr<EvaluationContext>	context_m;	// holds the values of variables_m, by slot
 
 // OPERATIONS
 public:
 	Tokenizer();
 	TokenList tokenize(string_type const& expression);
 
+	/*! Tokenizes 'expression', replacing 'spans' with the source span of each token. */
+	TokenList tokenize(string_type const& expression, std::vector<SourceSpan>& spans);
+	void add_keyword(string_type const& keyword, Token::pointer_type const& token);
+
+	/*! The context holding the values of this tokenizer's variables. */
+	[[nodiscard]] std::shared_ptr<EvaluationContext> const& context() const { return context_m; }
+
+	/*! The slot of the variable 'name', creating the variable if it is new. */
+	[[nodiscard]] std::size_t slot_of(string_type const& name);
+
+	/*! The token of the variable 'name', creating the variable if it is new. */
+	[[nodiscard]] Token::pointer_type variable(string_type const& name) { return _get_variable(name); }
+
+	/*! The name of the variable in 'slot'. */
+	[[nodiscard]] string_type const& variable_name(std::size_t slot) const { return variableNames_m.at(slot); }
+
 private:
+	[[nodiscard]] TokenList _tokenize(string_type const& expression, std::vector<SourceSpan>* spans);
 	[[nodiscard]] Token::pointer_type _get_identifier(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression);
+	[[nodiscard]] Token::pointer_type _get_variable(string_type const& name);
 	[[nodiscard]] Token::pointer_type _get_number(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression);
 };
 
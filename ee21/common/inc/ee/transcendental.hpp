@@ -0,0 +1,335 @@
+#pragma once
+/*!	\file	transcendental.hpp
+	\brief	High-precision transcendental functions for cpp_dec_float numbers.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Argument-reducing implementations of the elementary functions
+for boost::multiprecision::cpp_dec_float numbers of any
+precision.
+
+	log()		AGM: ln(x) = pi / 2AGM(1, 4/(x 2^m)) - m ln2
+				near 1: 2 atanh((x-1)/(x+1)) series
+	log10(), log2()
+	sin_cos(), sin(), cos(), tan()
+				x = q pi/2 + r, r / 2^s, Taylor series of 1-cos,
+				s doublings of 1-cos(2t) = 2v(2-v)
+	atan()		s half-angle reductions, then the Taylor series
+	asin(), acos(), atan2()
+	pow()		exp(y ln x)
+
+exp() is not replaced: boost's cpp_dec_float exp() already reduces its
+argument and was measured at parity with a k ln2 + r / 2^s version.
+transcendental::exp() forwards to it so the benchmarks cover it too.
+
+Calls between these functions are qualified so that argument-
+dependent lookup does not pick the boost overloads.  Series
+terms are divided by their small integer coefficients
+with cpp_dec_float's single-limb division, and every series
+stops once a term falls below the type's epsilon.  Arguments
+outside the domain or range of a reduction are passed to the
+boost implementation unchanged so special values behave the
+same as before.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Added exp().
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+
+namespace transcendental {
+
+	namespace detail {
+		/*! Number of halvings applied before a series: more halvings mean fewer series terms. */
+		template <typename T>
+		constexpr unsigned reduction_steps(unsigned perThousandDigits) {
+			return std::clamp<unsigned>(std::numeric_limits<T>::digits10 * perThousandDigits / 1000, 4, 60);
+		}
+
+		/*! x *= n; single-limb (fast) when n < 10^8. */
+		template <typename T>
+		void multiply(T& x, std::uint64_t n) { x.backend().mul_unsigned_long_long(n); }
+
+		/*! x /= n; single-limb (fast) when n < 10^8. */
+		template <typename T>
+		void divide(T& x, std::uint64_t n) { x.backend().div_unsigned_long_long(n); }
+
+		/*! x *= 2^n, in single-limb steps of 2^26. */
+		template <typename T>
+		void scale2(T& x, std::int64_t n) {
+			constexpr std::int64_t STEP = 26;
+			for (; n > 0; n -= std::min(n, STEP))
+				multiply(x, std::uint64_t(1) << std::min(n, STEP));
+			for (; n < 0; n += std::min(-n, STEP))
+				divide(x, std::uint64_t(1) << std::min(-n, STEP));
+		}
+
+		/*! True when 'term' no longer changes 'sum'. */
+		template <typename T>
+		bool negligible(T const& term, T const& sum) {
+			return abs(term) <= std::numeric_limits<T>::epsilon() * abs(sum);
+		}
+
+		/*! Largest |x| whose reduction quotient is computed in double precision. */
+		constexpr double REDUCTION_LIMIT = 1e15;
+	}
+
+
+
+	/*! Natural logarithm. */
+	template <typename T>
+	[[nodiscard]] T log(T const& x) {
+		if (!(x > 0) || !(boost::multiprecision::isfinite)(x))
+			return boost::multiprecision::log(x);
+		if (x == 1)
+			return T(0);
+
+		// near 1: ln(x) = 2 atanh(z) = 2 (z + z^3/3 + z^5/5 + ...), z = (x-1)/(x+1)
+		if (abs(T(x - 1)) < T(1) / 64) {
+			T const z = T(x - 1) / T(x + 1);
+			T const z2 = z * z;
+			T power = z, sum = z, term = z;
+			for (std::uint64_t n = 3; !detail::negligible(term, sum); n += 2) {
+				power *= z2;
+				term = power;
+				detail::divide(term, n);
+				sum += term;
+			}
+			detail::multiply(sum, 2);
+			return sum;
+		}
+
+		// s = x 2^m > 2^(p/2):  ln(x) = pi / (2 AGM(1, 4/s)) - m ln2
+		constexpr std::int64_t halfBits = std::int64_t(std::numeric_limits<T>::digits10 * 3.3219280948873623) / 2 + 16;
+		std::int64_t const m = halfBits - std::int64_t(std::floor(x.backend().order() * 3.3219280948873623));
+		T s = x;
+		detail::scale2(s, m);
+
+		T a = 1;
+		T b = T(4) / s;
+		while (!detail::negligible(T(a - b), a)) {
+			T const mean = a * b;
+			a += b;
+			detail::divide(a, 2);
+			b = sqrt(mean);
+		}
+
+		T result = boost::math::constants::pi<T>() / a;
+		detail::divide(result, 2);
+		T correction = boost::math::constants::ln_two<T>();
+		detail::multiply(correction, std::uint64_t(m < 0 ? -m : m));
+		return m < 0 ? T(result + correction) : T(result - correction);
+	}
+
+
+
+	/*! Common (base-10) logarithm. */
+	template <typename T>
+	[[nodiscard]] T log10(T const& x) {
+		return T(transcendental::log(x) / boost::math::constants::ln_ten<T>());
+	}
+
+
+
+	/*! Binary (base-2) logarithm. */
+	template <typename T>
+	[[nodiscard]] T log2(T const& x) {
+		return T(transcendental::log(x) / boost::math::constants::ln_two<T>());
+	}
+
+
+
+	/*! Sine and cosine of 'x', either of which may be skipped with a nullptr. */
+	template <typename T>
+	void sin_cos(T const& x, T* sine, T* cosine) {
+		double const approx = x.template convert_to<double>();
+		if (!(std::abs(approx) < detail::REDUCTION_LIMIT)) {
+			if (sine) *sine = boost::multiprecision::sin(x);
+			if (cosine) *cosine = boost::multiprecision::cos(x);
+			return;
+		}
+
+		// x = q pi/2 + r, |r| <= pi/4
+		auto const q = std::llround(approx / 1.57079632679489661923);
+		T multiple = boost::math::constants::half_pi<T>();
+		detail::multiply(multiple, std::uint64_t(std::llabs(q)));
+		T const r = q < 0 ? T(x + multiple) : T(x - multiple);
+
+		// v = 1 - cos(r / 2^s) by Taylor series
+		constexpr unsigned s = detail::reduction_steps<T>(40);
+		T t = r;
+		detail::scale2(t, -std::int64_t(s));
+		T const t2 = t * t;
+		T term = t2;
+		detail::divide(term, 2);
+		T v = term;
+		for (std::uint64_t n = 3; !detail::negligible(term, v); n += 2) {
+			term *= t2;
+			detail::divide(term, n * (n + 1));
+			term = -term;
+			v += term;
+		}
+
+		// 1 - cos(2t) = 2v(2 - v)
+		for (unsigned i = 0; i < s; ++i) {
+			v *= T(2 - v);
+			detail::multiply(v, 2);
+		}
+
+		T const c = 1 - v;
+		T sn = 0;
+		if (sine || (q & 1)) {
+			sn = sqrt(T(v * T(2 - v)));
+			if (r < 0)
+				sn = -sn;
+		}
+
+		switch (q & 3) {
+		case 0: if (sine) *sine = sn; if (cosine) *cosine = c; break;
+		case 1: if (sine) *sine = c; if (cosine) *cosine = -sn; break;
+		case 2: if (sine) *sine = -sn; if (cosine) *cosine = -c; break;
+		case 3: if (sine) *sine = -c; if (cosine) *cosine = sn; break;
+		}
+	}
+
+
+
+	/*! Sine. */
+	template <typename T>
+	[[nodiscard]] T sin(T const& x) {
+		T result;
+		transcendental::sin_cos<T>(x, &result, nullptr);
+		return result;
+	}
+
+
+
+	/*! Cosine. */
+	template <typename T>
+	[[nodiscard]] T cos(T const& x) {
+		T result;
+		transcendental::sin_cos<T>(x, nullptr, &result);
+		return result;
+	}
+
+
+
+	/*! Tangent. */
+	template <typename T>
+	[[nodiscard]] T tan(T const& x) {
+		T sine, cosine;
+		transcendental::sin_cos<T>(x, &sine, &cosine);
+		return T(sine / cosine);
+	}
+
+
+
+	/*! Arctangent. */
+	template <typename T>
+	[[nodiscard]] T atan(T const& x) {
+		if (x == 0 || !(boost::multiprecision::isfinite)(x))
+			return boost::multiprecision::atan(x);
+		if (x < 0)
+			return T(-transcendental::atan(T(-x)));
+		if (x > 1)
+			return T(boost::math::constants::half_pi<T>() - transcendental::atan(T(1 / x)));
+
+		// atan(x) = 2 atan(x / (1 + sqrt(1 + x^2)))
+		constexpr unsigned s = detail::reduction_steps<T>(12);
+		T y = x;
+		for (unsigned i = 0; i < s; ++i)
+			y /= T(1 + sqrt(T(1 + y * y)));
+
+		// atan(y) = y - y^3/3 + y^5/5 - ...
+		T const y2 = y * y;
+		T power = y, sum = y, term = y;
+		for (std::uint64_t n = 3; !detail::negligible(term, sum); n += 2) {
+			power *= y2;
+			power = -power;
+			term = power;
+			detail::divide(term, n);
+			sum += term;
+		}
+		detail::scale2(sum, s);
+		return sum;
+	}
+
+
+
+	/*! Arcsine. */
+	template <typename T>
+	[[nodiscard]] T asin(T const& x) {
+		if (!(abs(x) < 1))
+			return boost::multiprecision::asin(x);
+		return transcendental::atan(T(x / sqrt(T(T(1 - x) * T(1 + x)))));
+	}
+
+
+
+	/*! Arccosine, as 2 atan(sqrt((1-x)/(1+x))) to keep full precision near 1. */
+	template <typename T>
+	[[nodiscard]] T acos(T const& x) {
+		if (!(abs(x) < 1))
+			return boost::multiprecision::acos(x);
+		T result = transcendental::atan(T(sqrt(T(T(1 - x) / T(1 + x)))));
+		detail::multiply(result, 2);
+		return result;
+	}
+
+
+
+	/*! Arctangent of y/x in the quadrant of (x, y). */
+	template <typename T>
+	[[nodiscard]] T atan2(T const& y, T const& x) {
+		if (x == 0 || !(boost::multiprecision::isfinite)(x) || !(boost::multiprecision::isfinite)(y))
+			return boost::multiprecision::atan2(y, x);
+		T const angle = transcendental::atan(T(y / x));
+		if (x > 0)
+			return angle;
+		return y < 0 ? T(angle - boost::math::constants::pi<T>()) : T(angle + boost::math::constants::pi<T>());
+	}
+
+
+
+	/*! e^x; boost's exp(). */
+	template <typename T>
+	[[nodiscard]] T exp(T const& x) {
+		return boost::multiprecision::exp(x);
+	}
+
+
+
+	/*! x^y; exp(y ln x) for positive x and a fractional y, boost's repeated squaring for integral y. */
+	template <typename T>
+	[[nodiscard]] T pow(T const& x, T const& y) {
+		if (!(x > 0) || !(boost::multiprecision::isfinite)(x) || !(boost::multiprecision::isfinite)(y) || y == trunc(y))
+			return boost::multiprecision::pow(x, y);
+		return transcendental::exp(T(y * transcendental::log(x)));
+	}
+
+} // end-of-namespace transcendental
@@ -12,6 +12,12 @@ Declarations of the Variable class derived from Operand.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added dereference().
+	Added Variable::version() and Variable::last_version().
+	Values are stored in an EvaluationContext slot instead of the variable.
+	Slot variables resolve through the thread's active EvaluationContext, if any.
+
 Version 2021.10.26
 	C++ 20 validated
 
@@ -42,18 +48,49 @@ the program(s) have been supplied.
 =============================================================*/
 
 #include <ee/operand.hpp>
+#include <ee/evaluation_context.hpp>
+#include <cstddef>
+#include <memory>
 
 
-/*! Variable operand token. */
+/*! Variable operand token.
+	The token names a slot of an EvaluationContext; the value lives in the context.
+	The Tokenizer gives each variable name its own slot of the tokenizer's context;
+	while an EvaluationContext::Scope is active on the thread, such slot variables read
+	and write the active context instead, so one compiled program can run against many
+	contexts.  A default-constructed variable owns a one-slot context of its own and
+	always uses it. */
 class Variable : public Operand {
 public:
 	DEF_POINTER_TYPE(Variable)
 	using value_type = Operand::pointer_type;
+	using version_type = EvaluationContext::version_type;
 private:
-	value_type	value_m;
+	std::shared_ptr<EvaluationContext>	home_m;
+	std::size_t							slot_m = 0;
+	bool								isShared_m = false;	// resolved through the active context when there is one
 public:
-	Variable() = default;
-	[[nodiscard]]	value_type	value() const { return value_m; }
-					void		set(Operand::pointer_type const& value) { value_m = value; }
-	[[nodiscard]]	string_type	str() const override;
+	Variable() : home_m(std::make_shared<EvaluationContext>(1)) { }
+	Variable(std::shared_ptr<EvaluationContext> home, std::size_t slot) : home_m(std::move(home)), slot_m(slot), isShared_m(true) { }
+
+	[[nodiscard]]	value_type const&	value() const { return context().value(slot_m); }
+					void			set(Operand::pointer_type const& value) { context().set(slot_m, value); }
+	[[nodiscard]]	version_type	version() const { return context().version(slot_m); }
+	[[nodiscard]]	std::size_t		slot() const { return slot_m; }
+	[[nodiscard]]	string_type		str() const override;
+
+	/*! The context this variable currently reads and writes. */
+	[[nodiscard]] EvaluationContext& context() const {
+		auto active = isShared_m ? EvaluationContext::active() : nullptr;
+		return active ? *active : *home_m;
+	}
+
+	/*! The most recent version stamped by any variable. */
+	[[nodiscard]] static version_type last_version() { return EvaluationContext::last_version(); }
 };
+
+
+
+/*! Gets the operand that 'operand' stands for, resolving a variable to its stored value.
+	@throws std::runtime_error if the variable has not been initialized. */
+[[nodiscard]] Operand::pointer_type dereference(Operand::pointer_type const& operand);
@@ -8,6 +8,12 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Implemented evaluate(), including Jump/JumpIfFalse for lazy conditionals.
+	Evaluates a Program on a reusable stack pre-sized from the parse-time depth.
+	Added evaluate(Program, EvaluationContext&).
+	Added evaluate(Profile&); operations are timed when profiling.
+
 Version 2021.11.01
 	C++ 20 validated
 	Changed to GATS_TEST
@@ -32,41 +38,100 @@ the program(s) have been supplied.
 =============================================================*/
 
 #include <ee/RPNEvaluator.hpp>
+#include <ee/boolean.hpp>
 #include <ee/integer.hpp>
 #include <ee/operation.hpp>
+#include <ee/profile.hpp>
+#include <ee/pseudo_operation.hpp>
+#include <ee/variable.hpp>
 #include <cassert>
-#include <stack>
+#include <chrono>
+#include <stdexcept>
 #include <algorithm>
 
 
+/*! Validate and evaluate a postfix token list.
+	@throws std::runtime_error if an operation is missing operands or operands are left over.
+*/
 [[nodiscard]] Operand::pointer_type RPNEvaluator::evaluate( TokenList const& rpnExpression ) {
-	
-	std::stack<Token::pointer_type> stack;
-	for (auto tk : rpnExpression)
+	return evaluate(Program(rpnExpression));
+}
+
+
+
+/*! Evaluate a validated program.
+	The stack is an array sized once from the program's depth, and operations read their arguments in place.
+	Jump tokens transfer control within the list, so the untaken branch of a conditional is never evaluated.
+	@return the single operand remaining on the stack.
+*/
+[[nodiscard]] Operand::pointer_type RPNEvaluator::evaluate( Program const& program ) {
+	return run(program, nullptr);
+}
+
+
+
+/*! Evaluate the profiled program, timing each operation. */
+[[nodiscard]] Operand::pointer_type RPNEvaluator::evaluate( Profile& profile ) {
+	return run(profile.program(), &profile);
+}
+
+
+
+/*! The evaluation loop; 'profile', if not null, receives the time of each operation. */
+[[nodiscard]] Operand::pointer_type RPNEvaluator::run( Program const& program, Profile* profile ) {
+	using clock = std::chrono::steady_clock;
+	if (stack_m.size() < program.stack_depth())
+		stack_m.resize(program.stack_depth());
+
+	auto const& tokens = program.tokens();
+	std::size_t top = 0;
+	for (std::size_t next = 0; next < tokens.size(); )
 	{
+		auto const& tk = tokens[next++];
 		if (is<Operand>(tk))
-			stack.push(tk);
-		else
+			stack_m[top++] = std::static_pointer_cast<Operand>(tk);
+		else if (auto jump = dynamic_cast<Jump const*>(tk.get()))
 		{
-			auto operTk = convert<Operation>(tk);
-			auto operationNum = operTk->number_of_args();
-			if (operationNum > stack.size())
-				throw "Insufficient # operands of operation";
-			for (unsigned i = 0; i < operationNum; i++) 
+			if (is<JumpIfFalse>(jump))
 			{
-				auto operand = stack.top();
-				stack.pop();
-				auto oper = tk.get();
-				
+				assert(top > 0);
+				auto condition = dereference(stack_m[--top]);
+				stack_m[top].reset();
+				if (!is<Boolean>(condition))
+					throw std::runtime_error("Error: condition must be a boolean");
+				if (value_of<Boolean>(condition))
+					continue;
 			}
-			auto operand = stack.top();
-			stack.pop();
-			auto operation = convert<Operation>(tk);
-			operation->str();
+			next = jump->target();
+		}
+		else
+		{
+			auto operation = static_cast<Operation const*>(tk.get());
+			auto nArgs = operation->number_of_args();
+			assert(nArgs <= top);
+			top -= nArgs;
+			auto const start = profile ? clock::now() : clock::time_point();
+			auto result = operation->perform(ArgumentList(stack_m.data() + top, nArgs));
+			if (profile)
+				profile->record(next - 1, clock::now() - start);
+			for (std::size_t i = top + 1; i < top + nArgs; ++i)
+				stack_m[i].reset();
+			stack_m[top++] = std::move(result);
 		}
 	}
-	
-	// The following line is just a placeholder until you have completed the parser.
-	return Operand::pointer_type();
+
+	assert(top == 1);
+	auto result = std::move(stack_m[0]);
+	stack_m[0].reset();
+	return result;
 }
 
+
+
+/*! Evaluate a program against 'context' and add the value to its result history. */
+[[nodiscard]] Operand::pointer_type RPNEvaluator::evaluate( Program const& program, EvaluationContext& context ) {
+	EvaluationContext::Scope scope(context);
+	auto result = evaluate(program);
+	context.add_result(result);
+	return result;
+}
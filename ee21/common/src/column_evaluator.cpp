@@ -0,0 +1,367 @@
+/*!	\file	column_evaluator.cpp
+	\brief	ColumnEvaluator class implementation.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Added select().
+	select() checks the rows of an earlier selection.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/column_evaluator.hpp>
+#include <ee/boolean.hpp>
+#include <ee/integer.hpp>
+#include <ee/operator.hpp>
+#include <ee/real.hpp>
+#include <ee/variable.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+using namespace std;
+
+
+
+namespace {
+	using word_type = BooleanColumn::word_type;
+
+	/*! A numeric operand: a literal, or a bound column. */
+	using Numbers = variant<int64_t, double, IntegerColumn const*, RealColumn const*>;
+
+	/*! An entry of the evaluation stack: a computed Boolean column, a bound one, or numbers. */
+	using Value = variant<BooleanColumn, BooleanColumn const*, Numbers>;
+
+
+
+	/*! Row accessor of a numeric operand. */
+	template <typename T>
+	[[nodiscard]] auto rows_of(T const& numbers) {
+		if constexpr (is_pointer_v<T>)
+			return [data = numbers->data()](size_t row) { return data[row]; };
+		else
+			return [numbers](size_t) { return numbers; };
+	}
+
+	/*! Packs compare(lhs row, rhs row) for every row, 64 rows per word. */
+	template <typename COMPARE>
+	[[nodiscard]] BooleanColumn compare_rows(size_t rows, Numbers const& lhs, Numbers const& rhs, COMPARE compare) {
+		BooleanColumn result(rows);
+		auto words = result.words();
+		visit([&](auto const& l, auto const& r) {
+			auto const left = rows_of(l);
+			auto const right = rows_of(r);
+			using common_type = common_type_t<decltype(left(0)), decltype(right(0))>;
+			// the comparisons fill a byte per row, which vectorizes; a multiply gathers each 8 (little-endian) bytes into 8 bits
+			auto pack = [&](size_t first, size_t n) {
+				uint8_t flags[BooleanColumn::WORD_BITS] = {};
+				for (size_t bit = 0; bit < n; ++bit)
+					flags[bit] = compare(common_type(left(first + bit)), common_type(right(first + bit)));
+				word_type bits = 0;
+				for (size_t byte = 0; byte < sizeof(word_type); ++byte) {
+					word_type eight;
+					memcpy(&eight, flags + byte * 8, sizeof eight);
+					bits |= ((eight * 0x0102040810204080) >> 56) << (byte * 8);
+				}
+				return bits;
+			};
+			auto const full = rows / BooleanColumn::WORD_BITS;
+			for (size_t w = 0; w < full; ++w)
+				words[w] = pack(w * BooleanColumn::WORD_BITS, BooleanColumn::WORD_BITS);
+			if (auto const tail = rows % BooleanColumn::WORD_BITS)
+				words[full] = pack(full * BooleanColumn::WORD_BITS, tail);
+		}, lhs, rhs);
+		return result;
+	}
+
+	/*! The Boolean column of a stack value: computed, or bound to a variable. */
+	[[nodiscard]] BooleanColumn const& booleans_of(Value const& value) {
+		if (auto bound = get_if<BooleanColumn const*>(&value))
+			return **bound;
+		return get<BooleanColumn>(value);
+	}
+
+	/*! op(lhs word, rhs word) for every word.  The result reuses the storage of a computed
+		operand, so bound columns are never copied and a chain of operations allocates once. */
+	template <typename WORD_OP>
+	[[nodiscard]] BooleanColumn combine(Value&& lhs, Value&& rhs, WORD_OP op) {
+		// moving a column keeps its words where they are, so these stay valid
+		auto const left = booleans_of(lhs).words();
+		auto const right = booleans_of(rhs).words();
+		BooleanColumn result = holds_alternative<BooleanColumn>(lhs) ? get<BooleanColumn>(move(lhs))
+			: holds_alternative<BooleanColumn>(rhs) ? get<BooleanColumn>(move(rhs))
+			: BooleanColumn(booleans_of(lhs).size());
+		auto const words = result.words();
+		for (size_t i = 0; i < words.size(); ++i)
+			words[i] = op(left[i], right[i]);
+		result.clear_tail();
+		return result;
+	}
+
+	[[nodiscard]] Numbers negated(Numbers const& numbers) {
+		if (holds_alternative<int64_t>(numbers)) {
+			auto const value = get<int64_t>(numbers);
+			if (value == numeric_limits<int64_t>::min())
+				throw runtime_error("Error: integer does not fit in 64 bits");
+			return -value;
+		}
+		if (holds_alternative<double>(numbers))
+			return -get<double>(numbers);
+		throw runtime_error("Error: a column cannot be negated");
+	}
+
+
+
+	/*! Calls f with the comparison of a relational operator.
+		@return false if 'token' is not a relational operator. */
+	template <typename F>
+	bool with_comparison(Token::pointer_type const& token, F f) {
+		if (is<Equality>(token))			f([](auto l, auto r) { return l == r; });
+		else if (is<Inequality>(token))		f([](auto l, auto r) { return l != r; });
+		else if (is<Less>(token))			f([](auto l, auto r) { return l < r; });
+		else if (is<LessEqual>(token))		f([](auto l, auto r) { return l <= r; });
+		else if (is<Greater>(token))		f([](auto l, auto r) { return l > r; });
+		else if (is<GreaterEqual>(token))	f([](auto l, auto r) { return l >= r; });
+		else
+			return false;
+		return true;
+	}
+
+	/*! The operands of a predicate that compares two numeric operands, such as 'x > -3'.
+		@return nullopt for any other predicate. */
+	[[nodiscard]] optional<pair<Numbers, Numbers>> numeric_comparison(TokenList const& tokens, unordered_map<size_t, Column> const& columns) {
+		vector<Numbers> operands;
+		for (size_t i = 0; i + 1 < tokens.size(); ++i) {
+			auto const& token = tokens[i];
+			if (is<Variable>(token)) {
+				auto const column = columns.find(static_cast<Variable const*>(token.get())->slot());
+				if (column == columns.end())
+					return nullopt;
+				if (auto integers = get_if<IntegerColumn>(&column->second))
+					operands.push_back(integers);
+				else if (auto reals = get_if<RealColumn>(&column->second))
+					operands.push_back(reals);
+				else
+					return nullopt;
+			}
+			else if (is<Integer>(token)) {
+				auto const& value = value_of<Integer>(token);
+				if (value < numeric_limits<int64_t>::min() || value > numeric_limits<int64_t>::max())
+					return nullopt;
+				operands.push_back(value.convert_to<int64_t>());
+			}
+			else if (is<Real>(token))
+				operands.push_back(value_of<Real>(token).convert_to<double>());
+			else if (is<Negation>(token) && !operands.empty())
+				operands.back() = negated(operands.back());
+			else if (!is<Identity>(token) || operands.empty())
+				return nullopt;
+		}
+		if (operands.size() != 2)
+			return nullopt;
+		return pair(operands[0], operands[1]);
+	}
+
+	/*! The rows of 'rows' (every row when null) for which test(row) is true.  The loop is
+		branch-free: each row is written, and kept by advancing the end only if it passes. */
+	template <typename TEST>
+	[[nodiscard]] Selection keep(size_t nRows, Selection const* rows, TEST test) {
+		Selection kept(rows ? rows->size() : nRows);
+		size_t n = 0;
+		if (rows)
+			for (auto row : *rows) {
+				kept[n] = row;
+				n += test(row);
+			}
+		else
+			for (size_t row = 0; row < nRows; ++row) {
+				kept[n] = Selection::value_type(row);
+				n += test(row);
+			}
+		kept.resize(n);
+		return kept;
+	}
+}
+
+
+
+void ColumnEvaluator::bind(std::size_t slot, Column column) {
+	auto const rows = visit([](auto const& c) { return c.size(); }, column);
+	if (rows != rows_m)
+		throw runtime_error("Error: column has " + to_string(rows) + " rows, expected " + to_string(rows_m));
+	columns_m.insert_or_assign(slot, move(column));
+}
+
+
+
+/*! A stack machine whose values are whole columns. */
+[[nodiscard]] BooleanColumn ColumnEvaluator::evaluate(Program const& program) const {
+	vector<Value> stack;
+	stack.reserve(program.stack_depth());
+
+	auto pop = [&] {
+		if (stack.empty())
+			throw runtime_error("Error: insufficient operands");
+		auto value = move(stack.back());
+		stack.pop_back();
+		return value;
+	};
+	auto pop_booleans = [&] {
+		auto value = pop();
+		if (holds_alternative<Numbers>(value))
+			throw runtime_error("Error: operands must be booleans");
+		return value;
+	};
+	auto pop_numbers = [&] {
+		auto value = pop();
+		if (!holds_alternative<Numbers>(value))
+			throw runtime_error("Error: operands must be numbers");
+		return get<Numbers>(value);
+	};
+
+	// Relational operators: word operations on two Boolean columns, row comparisons on numbers
+	auto relational = [&](auto booleanOp, auto compareOp) {
+		auto rhs = pop();
+		auto lhs = pop();
+		if (!holds_alternative<Numbers>(lhs) && !holds_alternative<Numbers>(rhs))
+			stack.push_back(combine(move(lhs), move(rhs), booleanOp));
+		else if (holds_alternative<Numbers>(lhs) && holds_alternative<Numbers>(rhs))
+			stack.push_back(compare_rows(rows_m, get<Numbers>(lhs), get<Numbers>(rhs), compareOp));
+		else
+			throw runtime_error("Error: operands must be numbers");
+	};
+	auto logical = [&](auto wordOp) {
+		auto rhs = pop_booleans();
+		auto lhs = pop_booleans();
+		stack.push_back(combine(move(lhs), move(rhs), wordOp));
+	};
+
+	for (auto const& token : program.tokens()) {
+		if (is<Variable>(token)) {
+			auto const slot = static_cast<Variable const*>(token.get())->slot();
+			auto const column = columns_m.find(slot);
+			if (column == columns_m.end())
+				throw runtime_error("Error: variable slot " + to_string(slot) + " is not bound to a column");
+			if (auto booleans = get_if<BooleanColumn>(&column->second))
+				stack.push_back(booleans);
+			else if (auto integers = get_if<IntegerColumn>(&column->second))
+				stack.push_back(Numbers(integers));
+			else
+				stack.push_back(Numbers(&get<RealColumn>(column->second)));
+		}
+		else if (is<Boolean>(token))
+			stack.push_back(BooleanColumn(rows_m, value_of<Boolean>(token)));
+		else if (is<Integer>(token)) {
+			auto const& value = value_of<Integer>(token);
+			if (value < numeric_limits<int64_t>::min() || value > numeric_limits<int64_t>::max())
+				throw runtime_error("Error: integer does not fit in 64 bits");
+			stack.push_back(Numbers(value.convert_to<int64_t>()));
+		}
+		else if (is<Real>(token))
+			stack.push_back(Numbers(value_of<Real>(token).convert_to<double>()));
+		else if (is<Identity>(token))
+			stack.push_back(pop_numbers());
+		else if (is<Negation>(token))
+			stack.push_back(negated(pop_numbers()));
+		else if (is<Not>(token)) {
+			auto value = pop_booleans();
+			BooleanColumn column = holds_alternative<BooleanColumn>(value) ? get<BooleanColumn>(move(value)) : booleans_of(value);
+			stack.push_back(move(column.flip()));
+		}
+		else if (is<And>(token))
+			logical([](word_type l, word_type r) { return l & r; });
+		else if (is<Or>(token))
+			logical([](word_type l, word_type r) { return l | r; });
+		else if (is<Xor>(token))
+			logical([](word_type l, word_type r) { return l ^ r; });
+		else if (is<Nand>(token))
+			logical([](word_type l, word_type r) { return ~(l & r); });
+		else if (is<Nor>(token))
+			logical([](word_type l, word_type r) { return ~(l | r); });
+		else if (is<Xnor>(token))
+			logical([](word_type l, word_type r) { return ~(l ^ r); });
+		else if (is<Equality>(token))
+			relational([](word_type l, word_type r) { return ~(l ^ r); }, [](auto l, auto r) { return l == r; });
+		else if (is<Inequality>(token))
+			relational([](word_type l, word_type r) { return l ^ r; }, [](auto l, auto r) { return l != r; });
+		else if (is<Less>(token))
+			relational([](word_type l, word_type r) { return ~l & r; }, [](auto l, auto r) { return l < r; });
+		else if (is<LessEqual>(token))
+			relational([](word_type l, word_type r) { return ~l | r; }, [](auto l, auto r) { return l <= r; });
+		else if (is<Greater>(token))
+			relational([](word_type l, word_type r) { return l & ~r; }, [](auto l, auto r) { return l > r; });
+		else if (is<GreaterEqual>(token))
+			relational([](word_type l, word_type r) { return l | ~r; }, [](auto l, auto r) { return l >= r; });
+		else
+			throw runtime_error("Error: " + token->str() + " cannot be evaluated on columns");
+	}
+
+	if (stack.size() != 1 || holds_alternative<Numbers>(stack.back()))
+		throw runtime_error("Error: the expression is not a boolean");
+	if (holds_alternative<BooleanColumn>(stack.back()))
+		return get<BooleanColumn>(move(stack.back()));
+	return booleans_of(stack.back());
+}
+
+
+
+[[nodiscard]] Selection ColumnEvaluator::select(Program const& predicate) const {
+	if (rows_m > numeric_limits<Selection::value_type>::max())
+		throw runtime_error("Error: too many rows for a selection");
+	return select_rows(predicate, nullptr);
+}
+
+[[nodiscard]] Selection ColumnEvaluator::select(Program const& predicate, Selection const& rows) const {
+	if (any_of(rows.begin(), rows.end(), [this](auto row) { return row >= rows_m; }))
+		throw runtime_error("Error: selected row out of range");
+	return select_rows(predicate, &rows);
+}
+
+[[nodiscard]] Selection ColumnEvaluator::select_rows(Program const& predicate, Selection const* rows) const {
+	auto const& tokens = predicate.tokens();
+	if (auto operands = numeric_comparison(tokens, columns_m)) {
+		Selection selected;
+		auto const compared = with_comparison(tokens.back(), [&](auto compare) {
+			selected = visit([&](auto const& l, auto const& r) {
+				auto const left = rows_of(l);
+				auto const right = rows_of(r);
+				using common_type = common_type_t<decltype(left(0)), decltype(right(0))>;
+				return keep(rows_m, rows, [&](size_t row) { return compare(common_type(left(row)), common_type(right(row))); });
+			}, operands->first, operands->second);
+		});
+		if (compared)
+			return selected;
+	}
+
+	auto const bits = evaluate(predicate);
+	if (rows)
+		return keep(rows_m, rows, [&](size_t row) { return bits[row]; });
+
+	Selection selected;
+	selected.reserve(bits.count());
+	auto const words = bits.words();
+	for (size_t w = 0; w < words.size(); ++w)
+		for (auto word = words[w]; word != 0; word &= word - 1)
+			selected.push_back(Selection::value_type(w * BooleanColumn::WORD_BITS + countr_zero(word)));
+	return selected;
+}
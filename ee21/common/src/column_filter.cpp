@@ -0,0 +1,117 @@
+/*!	\file	column_filter.cpp
+	\brief	ColumnFilter class implementation.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/column_filter.hpp>
+#include <ee/operation.hpp>
+#include <ee/operator.hpp>
+#include <ee/pseudo_operation.hpp>
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+using namespace std;
+
+
+
+namespace {
+	/*! Appends the operands of the top-level 'and' operators of the sub-tree rooted at 'root'.
+		'first' maps each token to the first token of its sub-tree. */
+	void split(TokenList const& tokens, vector<size_t> const& first, size_t root, vector<Program>& conjuncts) {
+		if (is<And>(tokens[root])) {
+			split(tokens, first, first[root - 1] - 1, conjuncts);
+			split(tokens, first, root - 1, conjuncts);
+		}
+		else
+			conjuncts.emplace_back(TokenList(tokens.begin() + first[root], tokens.begin() + root + 1));
+	}
+
+	/*! Ordering key: the expected cost of a predicate per row it rejects.  Unmeasured predicates
+		(skipped because no rows survived) rank first, so they are measured by the next select(). */
+	[[nodiscard]] double priority(ColumnFilter::Predicate const& predicate) {
+		if (predicate.evaluations == 0)
+			return 0.0;
+		return predicate.cost / max(1.0 - predicate.selectivity, 1e-9);
+	}
+}
+
+
+
+ColumnFilter::ColumnFilter(Program const& program) {
+	auto const& tokens = program.tokens();
+	bool const hasJumps = any_of(tokens.begin(), tokens.end(), [](auto const& token) { return is<Jump>(token); });
+	if (tokens.empty() || hasJumps) {
+		predicates_m.push_back({ program });
+		return;
+	}
+
+	// the first token of each sub-tree, from the postfix arities
+	vector<size_t> first(tokens.size());
+	vector<size_t> stack;
+	for (size_t i = 0; i < tokens.size(); ++i) {
+		size_t start = i;
+		if (!is<Operand>(tokens[i])) {
+			auto const nArgs = static_cast<Operation const*>(tokens[i].get())->number_of_args();
+			assert(nArgs <= stack.size());
+			if (nArgs > 0)
+				start = stack[stack.size() - nArgs];
+			stack.resize(stack.size() - nArgs);
+		}
+		first[i] = start;
+		stack.push_back(start);
+	}
+
+	vector<Program> conjuncts;
+	split(tokens, first, tokens.size() - 1, conjuncts);
+	for (auto& conjunct : conjuncts)
+		predicates_m.push_back({ move(conjunct) });
+}
+
+
+
+[[nodiscard]] Selection ColumnFilter::select(ColumnEvaluator const& columns) {
+	using clock = chrono::steady_clock;
+
+	Selection rows;
+	for (size_t i = 0; i < predicates_m.size(); ++i) {
+		auto& predicate = predicates_m[i];
+		auto const inputRows = i == 0 ? columns.rows() : rows.size();
+		if (inputRows == 0)
+			break;
+
+		auto const start = clock::now();
+		rows = i == 0 ? columns.select(predicate.program) : columns.select(predicate.program, rows);
+		auto const elapsed = chrono::duration<double, nano>(clock::now() - start).count();
+
+		auto const cost = elapsed / inputRows;
+		auto const selectivity = double(rows.size()) / inputRows;
+		auto const weight = predicate.evaluations == 0 ? 1.0 : SMOOTHING;
+		predicate.cost += weight * (cost - predicate.cost);
+		predicate.selectivity += weight * (selectivity - predicate.selectivity);
+		++predicate.evaluations;
+	}
+
+	stable_sort(predicates_m.begin(), predicates_m.end(), [](auto const& l, auto const& r) { return priority(l) < priority(r); });
+	return rows;
+}
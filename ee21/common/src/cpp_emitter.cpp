@@ -0,0 +1,790 @@
+/*!	\file	cpp_emitter.cpp
+	\brief	C++ source generation implementation.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Constant folding can be turned off.
+	The prelude applies Factorial::max_argument and Power::max_result_bits.
+	Native Integer arithmetic throws on overflow.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/cpp_emitter.hpp>
+#include <ee/boolean.hpp>
+#include <ee/function.hpp>
+#include <ee/integer.hpp>
+#include <ee/operator.hpp>
+#include <ee/pseudo_operation.hpp>
+#include <ee/real.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/variable.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+using namespace std;
+
+
+
+namespace {
+	/*! Helpers of the Multiprecision types: the functions of operator.cpp and function.cpp on cpp_int and Real. */
+	char const MULTIPRECISION_TYPES[] = R"cpp(#ifndef EE_GENERATED_MULTIPRECISION
+#define EE_GENERATED_MULTIPRECISION
+#include <ee/transcendental.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ee_mp {
+	using integer = boost::multiprecision::cpp_int;
+	using real = boost::multiprecision::number<boost::multiprecision::cpp_dec_float<1000, std::int32_t, void>>;
+
+	[[nodiscard]] inline real real_abs(real const& x) { return real(boost::multiprecision::abs(x)); }
+	[[nodiscard]] inline real real_acos(real const& x) { return transcendental::acos(x); }
+	[[nodiscard]] inline real real_asin(real const& x) { return transcendental::asin(x); }
+	[[nodiscard]] inline real real_atan(real const& x) { return transcendental::atan(x); }
+	[[nodiscard]] inline real real_atan2(real const& y, real const& x) { return transcendental::atan2(y, x); }
+	[[nodiscard]] inline real real_ceil(real const& x) { return real(boost::multiprecision::ceil(x)); }
+	[[nodiscard]] inline real real_cos(real const& x) { return transcendental::cos(x); }
+	[[nodiscard]] inline real real_exp(real const& x) { return real(boost::multiprecision::exp(x)); }
+	[[nodiscard]] inline real real_floor(real const& x) { return real(boost::multiprecision::floor(x)); }
+	[[nodiscard]] inline real real_fmod(real const& l, real const& r) { return real(boost::multiprecision::fmod(l, r)); }
+	[[nodiscard]] inline real real_lb(real const& x) { return transcendental::log2(x); }
+	[[nodiscard]] inline real real_ln(real const& x) { return transcendental::log(x); }
+	[[nodiscard]] inline real real_log(real const& x) { return transcendental::log10(x); }
+	[[nodiscard]] inline real real_pow(real const& x, real const& y) { return transcendental::pow(x, y); }
+	[[nodiscard]] inline real real_sin(real const& x) { return transcendental::sin(x); }
+	[[nodiscard]] inline real real_sqrt(real const& x) { return real(boost::multiprecision::sqrt(x)); }
+	[[nodiscard]] inline real real_tan(real const& x) { return transcendental::tan(x); }
+
+	// Factorial::max_argument and Power::max_result_bits when the code was written
+	inline constexpr std::uint64_t max_factorial_argument = $MAX_ARGUMENT;
+	inline constexpr std::uint64_t max_power_result_bits = $MAX_RESULT_BITS;
+
+	[[nodiscard]] inline integer integer_add(integer const& l, integer const& r) { return integer(l + r); }
+	[[nodiscard]] inline integer integer_subtract(integer const& l, integer const& r) { return integer(l - r); }
+	[[nodiscard]] inline integer integer_multiply(integer const& l, integer const& r) { return integer(l * r); }
+	[[nodiscard]] inline integer integer_divide(integer const& l, integer const& r) { return integer(l / r); }
+	[[nodiscard]] inline integer integer_modulus(integer const& l, integer const& r) { return integer(l % r); }
+	[[nodiscard]] inline integer integer_negate(integer const& x) { return integer(-x); }
+	[[nodiscard]] inline integer integer_abs(integer const& x) { return integer(boost::multiprecision::abs(x)); }
+
+	[[nodiscard]] inline real real_power(real const& base, integer const& exponent) {
+		if (boost::multiprecision::abs(exponent) <= std::numeric_limits<long long>::max())
+			return real(boost::multiprecision::pow(base, exponent.convert_to<long long>()));
+		return transcendental::pow(base, real(exponent));
+	}
+
+	[[nodiscard]] inline integer integer_power(integer const& base, integer const& exponent) {
+		if (base == 0)
+			return exponent == 0 ? 1 : 0;
+		if (base == 1)
+			return 1;
+		if (base == -1)
+			return boost::multiprecision::bit_test(exponent, 0) ? -1 : 1;
+		integer const magnitude = boost::multiprecision::abs(base);
+		auto const shift = boost::multiprecision::lsb(magnitude);
+		bool const powerOfTwo = magnitude == integer(1) << shift;
+		auto const bitsPerFactor = powerOfTwo ? shift : boost::multiprecision::msb(magnitude) + 1;
+		if (exponent > max_power_result_bits / bitsPerFactor || exponent > std::numeric_limits<unsigned>::max())
+			throw std::runtime_error("Error: power result too large");
+		auto const e = exponent.convert_to<unsigned>();
+		if (powerOfTwo) {
+			integer const result = integer(1) << (std::uint64_t(shift) * e);
+			return base < 0 && e % 2 ? integer(-result) : result;
+		}
+		return integer(boost::multiprecision::pow(base, e));
+	}
+
+	[[nodiscard]] inline integer integer_factorial(integer const& n) {
+		if (n < 0)
+			throw std::runtime_error("Error: factorial of a negative number");
+		if (n > max_factorial_argument)
+			throw std::runtime_error("Error: factorial argument too large");
+		integer result = 1;
+		for (unsigned i = 2; i <= n; ++i)
+			result *= i;
+		return result;
+	}
+)cpp";
+
+
+	/*! Helpers of the Native types. */
+	char const NATIVE_TYPES[] = R"cpp(#ifndef EE_GENERATED_NATIVE
+#define EE_GENERATED_NATIVE
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ee_native {
+	using integer = std::int64_t;
+	using real = double;
+
+	[[nodiscard]] inline real real_abs(real x) { return std::fabs(x); }
+	[[nodiscard]] inline real real_acos(real x) { return std::acos(x); }
+	[[nodiscard]] inline real real_asin(real x) { return std::asin(x); }
+	[[nodiscard]] inline real real_atan(real x) { return std::atan(x); }
+	[[nodiscard]] inline real real_atan2(real y, real x) { return std::atan2(y, x); }
+	[[nodiscard]] inline real real_ceil(real x) { return std::ceil(x); }
+	[[nodiscard]] inline real real_cos(real x) { return std::cos(x); }
+	[[nodiscard]] inline real real_exp(real x) { return std::exp(x); }
+	[[nodiscard]] inline real real_floor(real x) { return std::floor(x); }
+	[[nodiscard]] inline real real_fmod(real l, real r) { return std::fmod(l, r); }
+	[[nodiscard]] inline real real_lb(real x) { return std::log2(x); }
+	[[nodiscard]] inline real real_ln(real x) { return std::log(x); }
+	[[nodiscard]] inline real real_log(real x) { return std::log10(x); }
+	[[nodiscard]] inline real real_pow(real x, real y) { return std::pow(x, y); }
+	[[nodiscard]] inline real real_sin(real x) { return std::sin(x); }
+	[[nodiscard]] inline real real_sqrt(real x) { return std::sqrt(x); }
+	[[nodiscard]] inline real real_tan(real x) { return std::tan(x); }
+
+	// Factorial::max_argument and Power::max_result_bits when the code was written
+	inline constexpr std::uint64_t max_factorial_argument = $MAX_ARGUMENT;
+	inline constexpr std::uint64_t max_power_result_bits = $MAX_RESULT_BITS;
+
+	inline constexpr integer integer_min = std::numeric_limits<integer>::min();
+	inline constexpr integer integer_max = std::numeric_limits<integer>::max();
+
+	// Integer arithmetic throws where the interpreter's result does not fit, instead of
+	// overflowing, which is undefined for signed integers.
+	[[noreturn]] inline void integer_overflow() { throw std::runtime_error("Error: integer overflow"); }
+
+	[[nodiscard]] inline integer integer_add(integer l, integer r) {
+		if (r > 0 ? l > integer_max - r : l < integer_min - r)
+			integer_overflow();
+		return l + r;
+	}
+
+	[[nodiscard]] inline integer integer_subtract(integer l, integer r) {
+		if (r < 0 ? l > integer_max + r : l < integer_min + r)
+			integer_overflow();
+		return l - r;
+	}
+
+	[[nodiscard]] inline integer integer_multiply(integer l, integer r) {
+		bool const overflows = l > 0
+			? (r > 0 ? l > integer_max / r : r < integer_min / l)
+			: (r > 0 ? l < integer_min / r : l != 0 && r < integer_max / l);
+		if (overflows)
+			integer_overflow();
+		return l * r;
+	}
+
+	[[nodiscard]] inline integer integer_divide(integer l, integer r) {
+		if (l == integer_min && r == -1)
+			integer_overflow();
+		return l / r;
+	}
+
+	[[nodiscard]] inline integer integer_modulus(integer l, integer r) { return r == -1 ? 0 : l % r; }
+
+	[[nodiscard]] inline integer integer_negate(integer x) {
+		if (x == integer_min)
+			integer_overflow();
+		return -x;
+	}
+
+	[[nodiscard]] inline integer integer_abs(integer x) { return x < 0 ? integer_negate(x) : x; }
+
+	[[nodiscard]] inline real real_power(real base, integer exponent) { return std::pow(base, real(exponent)); }
+
+	[[nodiscard]] inline integer integer_power(integer base, integer exponent) {
+		if (base == 0)
+			return exponent == 0 ? 1 : 0;
+		if (base == 1)
+			return 1;
+		if (base == -1)
+			return exponent % 2 != 0 ? -1 : 1;
+		// halving towards zero counts the bits of the base without negating it
+		std::uint64_t bits = 0;
+		bool powerOfTwo = true;
+		for (integer m = base; m != 0; m /= 2) {
+			++bits;
+			powerOfTwo &= m % 2 == 0 || m / 2 == 0;
+		}
+		if (static_cast<std::uint64_t>(exponent) > max_power_result_bits / (powerOfTwo ? bits - 1 : bits))
+			throw std::runtime_error("Error: power result too large");
+		integer result = 1;
+		for (;;) {
+			if (exponent % 2 != 0)
+				result = integer_multiply(result, base);
+			exponent /= 2;
+			if (exponent == 0)
+				return result;
+			base = integer_multiply(base, base);
+		}
+	}
+
+	[[nodiscard]] inline integer integer_factorial(integer n) {
+		if (n < 0)
+			throw std::runtime_error("Error: factorial of a negative number");
+		if (static_cast<std::uint64_t>(n) > max_factorial_argument)
+			throw std::runtime_error("Error: factorial argument too large");
+		integer result = 1;
+		for (integer i = 2; i <= n; ++i)
+			result = integer_multiply(result, i);
+		return result;
+	}
+)cpp";
+
+
+	/*! The operations on either set of types, written inside its namespace. */
+	char const OPERATIONS[] = R"cpp(
+	template <typename T> inline constexpr bool is_integer_v = std::is_same_v<T, integer>;
+	template <typename T> inline constexpr bool is_real_v = std::is_same_v<T, real>;
+	template <typename T> inline constexpr bool is_number_v = is_integer_v<T> || is_real_v<T>;
+	template <typename T> inline constexpr bool is_boolean_v = std::is_same_v<T, bool>;
+
+	/*! Integer when both operands are Integers, otherwise Real. */
+	template <typename L, typename R>
+	using promoted_t = std::conditional_t<is_integer_v<L> && is_integer_v<R>, integer, real>;
+
+	template <typename T>
+	[[nodiscard]] real to_real(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand is not a number");
+		return real(x);
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> add(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return integer_add(l, r);
+		else
+			return T(T(l) + T(r));
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> subtract(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return integer_subtract(l, r);
+		else
+			return T(T(l) - T(r));
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> multiply(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return integer_multiply(l, r);
+		else
+			return T(T(l) * T(r));
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> divide(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>) {
+			if (r == 0)
+				throw std::runtime_error("Error: division by zero");
+			return integer_divide(l, r);
+		}
+		else
+			return T(T(l) / T(r));
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> modulus(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>) {
+			if (r == 0)
+				throw std::runtime_error("Error: division by zero");
+			return integer_modulus(l, r);
+		}
+		else
+			return real_fmod(T(l), T(r));
+	}
+
+	/*! An Integer raised to a negative Integer power would be a Real, so it throws. */
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> power(L const& l, R const& r) {
+		static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+		if constexpr (is_integer_v<L> && is_integer_v<R>) {
+			if (r < 0)
+				throw std::runtime_error("Error: negative exponent of an integer");
+			return integer_power(l, r);
+		}
+		else if constexpr (is_integer_v<R>)
+			return real_power(l, r);
+		else
+			return real_pow(to_real(l), to_real(r));
+	}
+
+	template <typename T>
+	[[nodiscard]] T identity(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand must be a number");
+		return x;
+	}
+
+	template <typename T>
+	[[nodiscard]] T negate(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand must be a number");
+		if constexpr (is_integer_v<T>)
+			return integer_negate(x);
+		else
+			return T(-x);
+	}
+
+	template <typename T>
+	[[nodiscard]] integer factorial(T const& n) {
+		static_assert(is_integer_v<T>, "Error: factorial requires an integer");
+		return integer_factorial(n);
+	}
+
+	template <typename T>
+	[[nodiscard]] bool logical_not(T const& x) {
+		static_assert(is_boolean_v<T>, "Error: operand must be a boolean");
+		return !x;
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_and(L const& l, R const& r) {
+		static_assert(is_boolean_v<L> && is_boolean_v<R>, "Error: operands must be booleans");
+		return l && r;
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_or(L const& l, R const& r) {
+		static_assert(is_boolean_v<L> && is_boolean_v<R>, "Error: operands must be booleans");
+		return l || r;
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_xor(L const& l, R const& r) {
+		static_assert(is_boolean_v<L> && is_boolean_v<R>, "Error: operands must be booleans");
+		return l != r;
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_nand(L const& l, R const& r) { return !logical_and(l, r); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_nor(L const& l, R const& r) { return !logical_or(l, r); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool logical_xnor(L const& l, R const& r) { return !logical_xor(l, r); }
+
+	/*! Numeric comparison, or boolean comparison (false < true) of two booleans. */
+	template <typename L, typename R, typename COMPARE>
+	[[nodiscard]] bool compare(L const& l, R const& r, COMPARE compare) {
+		if constexpr (is_boolean_v<L> && is_boolean_v<R>)
+			return compare(l, r);
+		else {
+			static_assert(is_number_v<L> && is_number_v<R>, "Error: operands must be numbers");
+			using T = promoted_t<L, R>;
+			return compare(T(l), T(r));
+		}
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] bool equal(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a == b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool not_equal(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a != b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool less(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a < b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool less_equal(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a <= b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool greater(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a > b; }); }
+
+	template <typename L, typename R>
+	[[nodiscard]] bool greater_equal(L const& l, R const& r) { return compare(l, r, [](auto const& a, auto const& b) { return a >= b; }); }
+
+	template <typename T>
+	[[nodiscard]] T abs(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand is not a number");
+		if constexpr (is_integer_v<T>)
+			return integer_abs(x);
+		else
+			return real_abs(x);
+	}
+
+	template <typename T>
+	[[nodiscard]] T ceil(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand is not a number");
+		if constexpr (is_integer_v<T>)
+			return x;
+		else
+			return real_ceil(x);
+	}
+
+	template <typename T>
+	[[nodiscard]] T floor(T const& x) {
+		static_assert(is_number_v<T>, "Error: operand is not a number");
+		if constexpr (is_integer_v<T>)
+			return x;
+		else
+			return real_floor(x);
+	}
+
+	template <typename T> [[nodiscard]] real arccos(T const& x) { return real_acos(to_real(x)); }
+	template <typename T> [[nodiscard]] real arcsin(T const& x) { return real_asin(to_real(x)); }
+	template <typename T> [[nodiscard]] real arctan(T const& x) { return real_atan(to_real(x)); }
+	template <typename T> [[nodiscard]] real cos(T const& x) { return real_cos(to_real(x)); }
+	template <typename T> [[nodiscard]] real exp(T const& x) { return real_exp(to_real(x)); }
+	template <typename T> [[nodiscard]] real lb(T const& x) { return real_lb(to_real(x)); }
+	template <typename T> [[nodiscard]] real ln(T const& x) { return real_ln(to_real(x)); }
+	template <typename T> [[nodiscard]] real log(T const& x) { return real_log(to_real(x)); }
+	template <typename T> [[nodiscard]] real sin(T const& x) { return real_sin(to_real(x)); }
+	template <typename T> [[nodiscard]] real sqrt(T const& x) { return real_sqrt(to_real(x)); }
+	template <typename T> [[nodiscard]] real tan(T const& x) { return real_tan(to_real(x)); }
+
+	template <typename Y, typename X>
+	[[nodiscard]] real arctan2(Y const& y, X const& x) { return real_atan2(to_real(y), to_real(x)); }
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> maximum(L const& l, R const& r) {
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return l >= r ? l : r;
+		else {
+			auto const a = to_real(l), b = to_real(r);
+			return a >= b ? a : b;
+		}
+	}
+
+	template <typename L, typename R>
+	[[nodiscard]] promoted_t<L, R> minimum(L const& l, R const& r) {
+		using T = promoted_t<L, R>;
+		if constexpr (is_integer_v<T>)
+			return l <= r ? l : r;
+		else {
+			auto const a = to_real(l), b = to_real(r);
+			return a <= b ? a : b;
+		}
+	}
+
+	/*! if(): evaluates one branch; numeric branches of different types are converted to Real. */
+	template <typename C, typename THEN, typename ELSE>
+	[[nodiscard]] auto conditional(C const& condition, THEN const& then, ELSE const& otherwise) {
+		static_assert(is_boolean_v<C>, "Error: condition must be a boolean");
+		using A = decltype(then());
+		using B = decltype(otherwise());
+		static_assert(std::is_same_v<A, B> || (is_number_v<A> && is_number_v<B>), "Error: the branches of if() have different types");
+		using T = std::conditional_t<std::is_same_v<A, B>, A, promoted_t<A, B>>;
+		return condition ? T(then()) : T(otherwise());
+	}
+}
+#endif
+)cpp";
+
+
+
+	/*! Name of the prelude helper that performs 'token'. */
+	[[nodiscard]] char const* helper_name(Token::pointer_type const& token) {
+		if (is<Addition>(token))		return "add";
+		if (is<Subtraction>(token))		return "subtract";
+		if (is<Multiplication>(token))	return "multiply";
+		if (is<Division>(token))		return "divide";
+		if (is<Modulus>(token))			return "modulus";
+		if (is<Power>(token))			return "power";
+		if (is<Identity>(token))		return "identity";
+		if (is<Negation>(token))		return "negate";
+		if (is<Factorial>(token))		return "factorial";
+		if (is<Not>(token))				return "logical_not";
+		if (is<And>(token))				return "logical_and";
+		if (is<Or>(token))				return "logical_or";
+		if (is<Xor>(token))				return "logical_xor";
+		if (is<Nand>(token))			return "logical_nand";
+		if (is<Nor>(token))				return "logical_nor";
+		if (is<Xnor>(token))			return "logical_xnor";
+		if (is<Equality>(token))		return "equal";
+		if (is<Inequality>(token))		return "not_equal";
+		if (is<Less>(token))			return "less";
+		if (is<LessEqual>(token))		return "less_equal";
+		if (is<Greater>(token))			return "greater";
+		if (is<GreaterEqual>(token))	return "greater_equal";
+		if (is<Abs>(token))				return "abs";
+		if (is<Arccos>(token))			return "arccos";
+		if (is<Arcsin>(token))			return "arcsin";
+		if (is<Arctan>(token))			return "arctan";
+		if (is<Ceil>(token))			return "ceil";
+		if (is<Cos>(token))				return "cos";
+		if (is<Exp>(token))				return "exp";
+		if (is<Floor>(token))			return "floor";
+		if (is<Lb>(token))				return "lb";
+		if (is<Ln>(token))				return "ln";
+		if (is<Log>(token))				return "log";
+		if (is<Sin>(token))				return "sin";
+		if (is<Sqrt>(token))			return "sqrt";
+		if (is<Tan>(token))				return "tan";
+		if (is<Arctan2>(token))			return "arctan2";
+		if (is<Max>(token))				return "maximum";
+		if (is<Min>(token))				return "minimum";
+		if (is<Pow>(token))				return "power";
+		throw runtime_error("Error: " + token->str() + " cannot be emitted as C++");
+	}
+
+
+
+	/*! Translates a program, token by token, into one C++ expression. */
+	class Translator {
+		/*! A translated sub-expression and the postfix index of its first token. */
+		struct Expression {
+			string		code;
+			size_t		first;
+			bool		constant;	// reads no variables and has no jumps
+			size_t		firstStatic;	// statics it defines start here
+		};
+
+		/*! An if() whose condition has been translated. */
+		struct Conditional {
+			Expression	condition;
+			Expression	then;
+			size_t		end = numeric_limits<size_t>::max();	// index after the else branch, once known
+		};
+
+		CppNumbers			numbers_m;
+		CppFolding			folding_m;
+		string				namespace_m;
+		function<Token::string_type(size_t)> const&	variableName_m;
+		vector<Expression>	stack_m;
+		vector<Conditional>	conditionals_m;
+	public:
+		vector<string>		statics;		// definitions of the large literals
+		vector<string>		parameters;		// parameter names, in order of first use
+
+		Translator(CppNumbers numbers, CppFolding folding, function<Token::string_type(size_t)> const& variableName)
+			: numbers_m(numbers), folding_m(folding), namespace_m(numbers == CppNumbers::Native ? "ee_native" : "ee_mp"), variableName_m(variableName) { }
+
+		[[nodiscard]] string translate(TokenList const& tokens) {
+			for (size_t i = 0; i < tokens.size(); ++i) {
+				finish_conditionals(i);
+				auto const& token = tokens[i];
+				if (is<JumpIfFalse>(token)) {
+					conditionals_m.push_back({ pop(), {}, });
+				}
+				else if (is<Jump>(token)) {
+					conditionals_m.back().then = pop();
+					conditionals_m.back().end = static_cast<Jump const*>(token.get())->target();
+				}
+				else if (is<Variable>(token)) {
+					auto name = variableName_m(static_cast<Variable const*>(token.get())->slot()) + "_";
+					if (find(parameters.begin(), parameters.end(), name) == parameters.end())
+						parameters.push_back(name);
+					stack_m.push_back({ move(name), i, false, statics.size() });
+				}
+				else if (is<Operand>(token)) {
+					auto const firstStatic = statics.size();
+					stack_m.push_back({ literal(token), i, true, firstStatic });
+				}
+				else if (is<If>(token)) {
+					auto otherwise = pop(), then = pop(), condition = pop();
+					push_conditional(condition, then, otherwise);
+				}
+				else if (is<Operation>(token)) {
+					operation(tokens, i);
+				}
+				else
+					throw runtime_error("Error: " + token->str() + " cannot be emitted as C++");
+			}
+			finish_conditionals(tokens.size());
+			assert(stack_m.size() == 1 && conditionals_m.empty());
+			return stack_m.back().code;
+		}
+
+	private:
+		[[nodiscard]] Expression pop() {
+			auto expression = move(stack_m.back());
+			stack_m.pop_back();
+			return expression;
+		}
+
+		/*! Completes the if()s whose else branch ends before 'index'. */
+		void finish_conditionals(size_t index) {
+			while (!conditionals_m.empty() && conditionals_m.back().end == index) {
+				auto conditional = move(conditionals_m.back());
+				conditionals_m.pop_back();
+				push_conditional(conditional.condition, conditional.then, pop());
+			}
+		}
+
+		void push_conditional(Expression const& condition, Expression const& then, Expression const& otherwise) {
+			stack_m.push_back({ namespace_m + "::conditional(" + condition.code
+				+ ", [&] { return " + then.code + "; }, [&] { return " + otherwise.code + "; })", condition.first, false, condition.firstStatic });
+		}
+
+		/*! Calls the helper of the operation at 'index', or writes its value when its arguments are constant. */
+		void operation(TokenList const& tokens, size_t index) {
+			auto const& token = tokens[index];
+			if (is<Assignment>(token) || is<Result>(token))
+				throw runtime_error("Error: " + token->str() + " cannot be emitted as C++");
+
+			auto const nArgs = static_cast<Operation const*>(token.get())->number_of_args();
+			vector<Expression> args(stack_m.end() - nArgs, stack_m.end());
+			stack_m.resize(stack_m.size() - nArgs);
+			auto const first = args.empty() ? index : args.front().first;
+			auto const firstStatic = args.empty() ? statics.size() : args.front().firstStatic;
+			auto const constant = all_of(args.begin(), args.end(), [](auto const& arg) { return arg.constant; });
+
+			if (constant && folding_m == CppFolding::Constants)
+				if (auto value = fold(tokens, first, index, firstStatic)) {
+					stack_m.push_back({ move(*value), first, true, firstStatic });
+					return;
+				}
+
+			string code = namespace_m + "::" + helper_name(token) + "(";
+			for (size_t i = 0; i < args.size(); ++i)
+				code += (i ? ", " : "") + args[i].code;
+			stack_m.push_back({ code + ")", first, constant, firstStatic });
+		}
+
+		/*! The literal of the Integer or Boolean value of tokens[first..last], if it has one.
+			The statics of the folded literals, from 'firstStatic' on, are dropped. */
+		[[nodiscard]] optional<string> fold(TokenList const& tokens, size_t first, size_t last, size_t firstStatic) {
+			Operand::pointer_type value;
+			try {
+				value = RPNEvaluator().evaluate(Program(TokenList(tokens.begin() + first, tokens.begin() + last + 1)));
+			}
+			catch (exception const&) {
+				return nullopt;		// the error is left to the generated code
+			}
+			if (!is<Integer>(value) && !is<Boolean>(value))
+				return nullopt;
+			if (numbers_m == CppNumbers::Native && is<Integer>(value) && !fits_int64(value_of<Integer>(value)))
+				return nullopt;
+			statics.resize(firstStatic);
+			return literal(value);
+		}
+
+		[[nodiscard]] static bool fits_int64(Integer::value_type const& value) {
+			return value >= numeric_limits<int64_t>::min() && value <= numeric_limits<int64_t>::max();
+		}
+
+		/*! C++ for an operand token; large Multiprecision literals become static locals. */
+		[[nodiscard]] string literal(Token::pointer_type const& token) {
+			if (is<Boolean>(token))
+				return value_of<Boolean>(token) ? "true" : "false";
+
+			if (is<Integer>(token)) {
+				auto const& value = value_of<Integer>(token);
+				auto const text = value.str();
+				if (numbers_m == CppNumbers::Native && !fits_int64(value))
+					throw runtime_error("Error: integer " + text + " does not fit the native integer type");
+				if (value == numeric_limits<int64_t>::min())
+					return namespace_m + "::integer(-9223372036854775807 - 1)";
+				if (fits_int64(value))
+					return namespace_m + "::integer(" + text + ")";
+				return add_static("integer", "(\"" + text + "\")");
+			}
+
+			if (is<Real>(token)) {
+				if (numbers_m == CppNumbers::Native) {
+					auto const value = value_of<Real>(token).convert_to<double>();
+					if (!isfinite(value))
+						throw runtime_error("Error: real " + token->str() + " does not fit the native real type");
+					ostringstream oss;
+					oss << setprecision(numeric_limits<double>::max_digits10) << value;
+					auto text = oss.str();
+					if (text.find_first_of(".e") == string::npos)
+						text += ".0";
+					return text;
+				}
+				if (is<Pi>(token))
+					return add_static("real", " = boost::math::constants::pi<ee_mp::real>()");
+				if (is<E>(token))
+					return add_static("real", " = boost::math::constants::e<ee_mp::real>()");
+				auto text = token->str();
+				text.erase(text.find_last_not_of('0') + 1);
+				if (text.back() == '.')
+					text += '0';
+				return add_static("real", "(\"" + text + "\")");
+			}
+
+			throw runtime_error("Error: " + token->str() + " cannot be emitted as C++");
+		}
+
+		[[nodiscard]] string add_static(string const& type, string const& initializer) {
+			auto name = "literal" + to_string(statics.size());
+			statics.push_back("static " + namespace_m + "::" + type + " const " + name + initializer + ";");
+			return name;
+		}
+	};
+}
+
+
+
+/*! The limits are written as the values they have now. */
+void emit_cpp_prelude(std::ostream& os, CppNumbers numbers) {
+	string types = numbers == CppNumbers::Native ? NATIVE_TYPES : MULTIPRECISION_TYPES;
+	auto fill = [&](string const& placeholder, uint64_t value) {
+		types.replace(types.find(placeholder), placeholder.size(), to_string(value));
+	};
+	fill("$MAX_ARGUMENT", Factorial::max_argument.load());
+	fill("$MAX_RESULT_BITS", Power::max_result_bits.load());
+	os << "// Helpers of the functions written by emit_cpp().\n" << types << OPERATIONS;
+}
+
+
+
+/*! Writes
+
+		template <typename T0, ...>
+		[[nodiscard]] auto name(T0 const& variable0_, ...) {
+			static ... const literal0(...);
+			return <expression>;
+		}
+
+	The parameter names end in '_' so that no variable name can be a keyword or collide with
+	the literals. */
+void emit_cpp(std::ostream& os, Program const& program, std::string const& name, CppNumbers numbers,
+	std::function<Token::string_type(std::size_t slot)> const& variable_name, CppFolding folding) {
+	Translator translator(numbers, folding, variable_name);
+	auto code = translator.translate(program.tokens());
+
+	auto const& names = translator.parameters;
+	if (names.empty())
+		os << "[[nodiscard]] inline auto " << name << "() {\n";
+	else {
+		os << "template <";
+		for (size_t i = 0; i < names.size(); ++i)
+			os << (i ? ", " : "") << "typename T" << i;
+		os << ">\n[[nodiscard]] auto " << name << "(";
+		for (size_t i = 0; i < names.size(); ++i)
+			os << (i ? ", " : "") << "T" << i << " const& " << names[i];
+		os << ") {\n";
+	}
+	for (auto const& definition : translator.statics)
+		os << '\t' << definition << '\n';
+	os << "\treturn " << code << ";\n}\n";
+}
@@ -0,0 +1,87 @@
+/*!	\file	evaluation_context.cpp
+	\brief	EvaluationContext class implementation.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Added the result history, Scope and active().
+	The result history is a bounded ResultHistory.
+	active() is inline.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/evaluation_context.hpp>
+#include <algorithm>
+#include <atomic>
+
+
+
+namespace {
+	std::atomic<EvaluationContext::version_type> versionClock{ 0 };
+}
+
+
+
+EvaluationContext::Scope::Scope(EvaluationContext& context) : previous_m(active_sm) {
+	active_sm = &context;
+}
+
+EvaluationContext::Scope::~Scope() {
+	active_sm = previous_m;
+}
+
+
+
+void EvaluationContext::reserve_slots(std::size_t slots) {
+	if (slots > values_m.size()) {
+		values_m.resize(slots);
+		versions_m.resize(slots);
+	}
+}
+
+
+
+void EvaluationContext::set(std::size_t slot, Operand::pointer_type const& value) {
+	reserve_slots(slot + 1);
+	values_m[slot] = value;
+	versions_m[slot] = ++versionClock;
+}
+
+
+
+/*! All the bound slots share one version. */
+void EvaluationContext::bind(std::size_t first, std::span<Operand::pointer_type const> row) {
+	reserve_slots(first + row.size());
+	std::copy(row.begin(), row.end(), values_m.begin() + first);
+	std::fill_n(versions_m.begin() + first, row.size(), ++versionClock);
+}
+
+
+
+[[nodiscard]] EvaluationContext::version_type EvaluationContext::last_version() {
+	return versionClock.load();
+}
+
+
+
+[[nodiscard]] Operand::pointer_type const& EvaluationContext::unset() {
+	static Operand::pointer_type const none;
+	return none;
+}
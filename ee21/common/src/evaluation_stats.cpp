@@ -0,0 +1,47 @@
+/*!	\file	evaluation_stats.cpp
+	\brief	EvaluationStats class implementation.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/evaluation_stats.hpp>
+#include <iomanip>
+using namespace std;
+
+
+
+ostream& operator << (ostream& os, EvaluationStats const& stats) {
+	static char const* const names[EvaluationStats::STAGES] = { "tokenize", "parse", "evaluate" };
+	auto const flags = os.flags();
+	os << left << setw(10) << "stage" << right << setw(10) << "runs" << setw(14) << "mean ns"
+		<< setw(14) << "max ns" << setw(14) << "total ns" << setw(14) << "allocations" << '\n';
+	for (size_t i = 0; i < EvaluationStats::STAGES; ++i) {
+		auto const& stage = stats[Stage(i)];
+		os << left << setw(10) << names[i] << right << setw(10) << stage.runs << setw(14) << stage.mean().count()
+			<< setw(14) << stage.longest.count() << setw(14) << stage.total.count() << setw(14) << stage.allocations << '\n';
+	}
+	os << "expressions " << stats.expressions() << ", tokens " << stats.tokens() << ", program tokens "
+		<< stats.program_tokens() << ", max stack depth " << stats.max_stack_depth() << '\n';
+	os.flags(flags);
+	return os;
+}
@@ -8,6 +8,17 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added result history for the Result function.
+	Compiles to a Program so malformed expressions are rejected before evaluation.
+	Added watch() and update() for incremental re-evaluation.
+	The result history lives in the evaluator's EvaluationContext.
+	Added save() and load().
+	Added emit_cpp().
+	evaluate() and compile() collect per-stage stats when enabled.
+	Added profile().
+	emit_cpp() can leave constants unfolded.
+
 Version 2021.11.01
 	C++ 20 validated
 
@@ -32,13 +43,24 @@ the program(s) have been supplied.
 #include <ee/parser.hpp>
 #include <ee/RPNEvaluator.hpp>
 #include <ee/function.hpp>
+#include <ee/incremental_program.hpp>
+#include <ee/serialization.hpp>
+#include <algorithm>
+#include <set>
 
 #if defined(SHOW_STEPS)
 #include <iostream>
 #endif
 
 [[nodiscard]] ExpressionEvaluator::result_type ExpressionEvaluator::evaluate( ExpressionEvaluator::expression_type const& expr ) {
-	TokenList infixTokens = tokenizer_m.tokenize(expr);
+	Program program = compile(expr);
+	return run_stage(Stage::Evaluate, [&] { return rpn_m.evaluate(program, context()); });
+}
+
+
+
+[[nodiscard]] Program ExpressionEvaluator::compile( ExpressionEvaluator::expression_type const& expr ) {
+	TokenList infixTokens = run_stage(Stage::Tokenize, [&] { return tokenizer_m.tokenize(expr); });
 #if defined(SHOW_STEPS)
 	{ using namespace std;
 	cout << "Lexer output" << endl;
@@ -47,15 +69,100 @@ the program(s) have been supplied.
 	}
 #endif
 
-	TokenList postfixTokens = parser_m.parse(infixTokens);
+	Program program = run_stage(Stage::Parse, [&] { return parser_m.compile(infixTokens); });
 #if defined(SHOW_STEPS)
 	{ using namespace std;
-	cout << "Parser output" << endl;
-	copy(postfixTokens.begin(), postfixTokens.end(), ostream_iterator<Token::pointer_type>(cout, " "));
+	cout << "Parser output (stack depth " << program.stack_depth() << ")" << endl;
+	copy(program.tokens().begin(), program.tokens().end(), ostream_iterator<Token::pointer_type>(cout, " "));
 	std::cout << std::endl;
 	}
 #endif
 
-	Operand::pointer_type result = rpn_m.evaluate(postfixTokens);
-	return result;
+	if (statsEnabled_m)
+		stats_m.add_expression(infixTokens.size(), program.tokens().size(), program.stack_depth());
+	return program;
+}
+
+
+
+[[nodiscard]] Profile ExpressionEvaluator::profile( ExpressionEvaluator::expression_type const& expr, std::size_t repetitions ) {
+	std::vector<SourceSpan> spans;
+	auto const infixTokens = tokenizer_m.tokenize(expr, spans);
+	std::vector<std::size_t> origins;
+	Program program(parser_m.parse(infixTokens, origins));
+	Profile profile(expr, infixTokens, spans, std::move(program), origins);
+
+	EvaluationContext::Scope scope(context());
+	for (std::size_t i = 0; i < repetitions; ++i)
+		(void)rpn_m.evaluate(profile);
+	return profile;
+}
+
+
+
+void ExpressionEvaluator::save(Program const& program, std::ostream& os) const {
+	write_program(os, program, [this](std::size_t slot) { return tokenizer_m.variable_name(slot); });
+}
+
+
+
+[[nodiscard]] Program ExpressionEvaluator::load(std::span<std::byte const> bytes) {
+	return read_program(bytes, [this](Token::string_type const& name) { return tokenizer_m.variable(name); });
+}
+
+
+
+void ExpressionEvaluator::emit_cpp(Program const& program, std::string const& name, CppNumbers numbers, std::ostream& os, CppFolding folding) const {
+	::emit_cpp(os, program, name, numbers, [this](std::size_t slot) { return tokenizer_m.variable_name(slot); }, folding);
+}
+
+
+
+/*! Compile 'expr' into a watched expression and evaluate it once. */
+[[nodiscard]] ExpressionEvaluator::watch_id ExpressionEvaluator::watch( ExpressionEvaluator::expression_type const& expr ) {
+	EvaluationContext::Scope scope(context());
+	IncrementalProgram program(compile(expr));
+	(void)program.evaluate();
+
+	watch_id const id = watched_m.size();
+	for (auto variable : program.reads())
+		dependents_m[variable].push_back(id);
+	if (program.is_volatile())
+		volatile_m.push_back(id);
+	watched_m.push_back(std::move(program));
+	return id;
+}
+
+
+
+/*! Re-evaluate, in watch order, the dirty watched expressions that read a changed variable.
+	An expression that assigns a variable queues the later expressions that read it, so
+	chains of assignments settle in one update(); earlier readers are found by the next one. */
+std::size_t ExpressionEvaluator::update() {
+	EvaluationContext::Scope scope(context());
+	std::set<watch_id> pending(volatile_m.begin(), volatile_m.end());
+	auto enqueue = [&](Variable::version_type since, watch_id first) {
+		for (auto const& [variable, dependents] : dependents_m)
+			if (variable->version() > since)
+				pending.insert(std::lower_bound(dependents.begin(), dependents.end(), first), dependents.end());
+	};
+
+	auto const now = Variable::last_version();
+	enqueue(updated_m, 0);
+	updated_m = now;
+
+	std::size_t count = 0;
+	while (!pending.empty()) {
+		auto const id = *pending.begin();
+		pending.erase(pending.begin());
+		auto& program = watched_m[id];
+		if (!program.is_dirty())
+			continue;
+		auto const before = Variable::last_version();
+		(void)program.evaluate();
+		++count;
+		if (Variable::last_version() != before)
+			enqueue(before, id + 1);
+	}
+	return count;
 }
@@ -0,0 +1,193 @@
+/*!	\file	formula_graph.cpp
+	\brief	FormulaGraph class implementation.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/formula_graph.hpp>
+#include <ee/operator.hpp>
+#include <algorithm>
+#include <cctype>
+#include <exception>
+#include <future>
+#include <stdexcept>
+#include <utility>
+using namespace std;
+
+
+
+namespace {
+	/*! The identifier at the start of 'expression'. */
+	[[nodiscard]] FormulaGraph::name_type leading_name(FormulaGraph::expression_type const& expression) {
+		auto first = find_if_not(expression.begin(), expression.end(), [](unsigned char c) { return isspace(c); });
+		auto last = find_if_not(first, expression.end(), [](unsigned char c) { return isalnum(c); });
+		return FormulaGraph::name_type(first, last);
+	}
+}
+
+
+
+FormulaGraph::FormulaGraph(unsigned threads) {
+	if (threads > 1)
+		pool_m = make_unique<ThreadPool>(threads);
+}
+
+
+
+/*! Compile the formula, then reschedule with it in place; the previous definition is restored if scheduling fails. */
+FormulaGraph::name_type FormulaGraph::define(expression_type const& expression) {
+	TokenList infix = tokenizer_m.tokenize(expression);
+	if (infix.size() < 3 || !is<Variable>(infix[0]) || !is<Assignment>(infix[1]))
+		throw runtime_error("Error: a formula must have the form name = expression");
+	if (any_of(infix.begin() + 2, infix.end(), [](Token::pointer_type const& tk) { return is<Assignment>(tk); }))
+		throw runtime_error("Error: a formula may only assign one variable");
+
+	Formula formula{ convert<Variable>(infix[0]), expression, make_unique<IncrementalProgram>(parser_m.compile(infix)) };
+	auto const name = leading_name(expression);
+
+	auto candidate = formulas_m.find(name);
+	Formula previous;
+	bool const replacing = candidate != formulas_m.end();
+	if (replacing)
+		previous = std::move(candidate->second);
+	formulas_m[name] = std::move(formula);
+
+	try {
+		levels_m = schedule(formulas_m);
+	}
+	catch (...) {
+		if (replacing)
+			formulas_m[name] = std::move(previous);
+		else
+			formulas_m.erase(name);
+		throw;
+	}
+	return name;
+}
+
+
+
+void FormulaGraph::remove(name_type const& name) {
+	formulas_m.erase(name);
+	levels_m = schedule(formulas_m);
+}
+
+
+
+/*! Evaluate each level's dirty formulas, in parallel when a pool is available, waiting for the level before starting the next.
+	The first error of a level is rethrown after the whole level has finished. */
+std::size_t FormulaGraph::recalculate() {
+	size_t count = 0;
+	for (auto const& level : levels_m) {
+		vector<IncrementalProgram*> dirty;
+		for (auto const& name : level) {
+			auto& program = *formulas_m.at(name).program;
+			if (program.is_dirty())
+				dirty.push_back(&program);
+		}
+		count += dirty.size();
+
+		if (!pool_m || dirty.size() < 2) {
+			for (auto program : dirty)
+				(void)program->evaluate();
+			continue;
+		}
+
+		vector<future<void>> pending;
+		pending.reserve(dirty.size());
+		for (auto program : dirty)
+			pending.push_back(pool_m->submit([program] { (void)program->evaluate(); }));
+		exception_ptr error;
+		for (auto& task : pending) {
+			try {
+				task.get();
+			}
+			catch (...) {
+				if (!error)
+					error = current_exception();
+			}
+		}
+		if (error)
+			rethrow_exception(error);
+	}
+	return count;
+}
+
+
+
+[[nodiscard]] Operand::pointer_type FormulaGraph::value(name_type const& name) {
+	TokenList tokens = tokenizer_m.tokenize(name);
+	if (tokens.size() != 1 || !is<Variable>(tokens[0]))
+		throw runtime_error("Error: '" + name + "' is not a variable name");
+	return dereference(static_pointer_cast<Operand>(tokens[0]));
+}
+
+
+
+/*! Kahn's algorithm: a formula's level is one more than the highest level of the formulas assigning the variables it reads.
+	@throws std::runtime_error naming the formulas on a cycle. */
+[[nodiscard]] vector<vector<FormulaGraph::name_type>> FormulaGraph::schedule(map<name_type, Formula> const& formulas) {
+	map<Variable const*, name_type> assignedBy;
+	for (auto const& [name, formula] : formulas)
+		assignedBy[formula.target.get()] = name;
+
+	map<name_type, size_t> unresolved;
+	map<name_type, vector<name_type>> readers;
+	for (auto const& [name, formula] : formulas) {
+		unresolved[name] = 0;
+		for (auto variable : formula.program->reads()) {
+			auto writer = assignedBy.find(variable);
+			if (writer == assignedBy.end())
+				continue;
+			++unresolved[name];
+			readers[writer->second].push_back(name);
+		}
+	}
+
+	vector<vector<name_type>> levels;
+	vector<name_type> ready;
+	for (auto const& [name, count] : unresolved)
+		if (count == 0)
+			ready.push_back(name);
+
+	size_t scheduled = 0;
+	while (!ready.empty()) {
+		scheduled += ready.size();
+		vector<name_type> next;
+		for (auto const& name : ready)
+			for (auto const& reader : readers[name])
+				if (--unresolved[reader] == 0)
+					next.push_back(reader);
+		levels.push_back(std::move(ready));
+		ready = std::move(next);
+	}
+
+	if (scheduled != formulas.size()) {
+		string cycle;
+		for (auto const& [name, count] : unresolved)
+			if (count > 0)
+				cycle += (cycle.empty() ? "" : ", ") + name;
+		throw runtime_error("Error: circular reference among " + cycle);
+	}
+	return levels;
+}
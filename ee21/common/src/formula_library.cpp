@@ -0,0 +1,253 @@
+/*!	\file	formula_library.cpp
+	\brief	FormulaLibrary class implementation.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/formula_library.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+
+namespace {
+	constexpr char			LIBRARY_MAGIC[4] = { 'E', 'E', 'L', 'B' };
+	constexpr std::uint16_t	LIBRARY_VERSION = 1;
+	constexpr std::uint16_t	BYTE_ORDER_MARK = 0x0102;
+
+	struct LibraryHeader {
+		char			magic[4];
+		std::uint16_t	version;
+		std::uint16_t	byteOrder;
+		std::uint32_t	formulaCount;
+		std::uint32_t	bucketCount;
+		std::uint64_t	namesOffset;
+		std::uint64_t	namesSize;
+		std::uint64_t	programsOffset;
+		std::uint64_t	programsSize;
+	};
+
+	static_assert(sizeof(LibraryHeader) == 48);
+
+	/*! 64-bit FNV-1a: stable across builds and platforms, unlike std::hash. */
+	[[nodiscard]] std::uint64_t name_hash(std::string_view name) {
+		std::uint64_t hash = 14695981039346656037ull;
+		for (unsigned char c : name) {
+			hash ^= c;
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+}
+
+
+
+/*! An index entry; a bucket with a programSize of 0 is empty. */
+struct FormulaLibrary::Bucket {
+	std::uint64_t	hash;
+	std::uint32_t	nameOffset;
+	std::uint32_t	nameSize;
+	std::uint64_t	programOffset;
+	std::uint64_t	programSize;
+};
+
+
+/*! A read-only view of a whole file. */
+struct FormulaLibrary::Mapping {
+	std::byte const*	data = nullptr;
+	std::size_t			size = 0;
+#if defined(_WIN32)
+	HANDLE				file = INVALID_HANDLE_VALUE;
+	HANDLE				view = nullptr;
+#endif
+
+	explicit Mapping(std::filesystem::path const& path) {
+		auto fail = [&] { throw std::runtime_error("Error: cannot map formula library " + path.string()); };
+#if defined(_WIN32)
+		file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		LARGE_INTEGER fileSize;
+		if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+			close(), fail();
+		view = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (view == nullptr)
+			close(), fail();
+		data = static_cast<std::byte const*>(MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0));
+		if (data == nullptr)
+			close(), fail();
+		size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+		int const fd = ::open(path.c_str(), O_RDONLY);
+		struct stat status;
+		if (fd < 0 || ::fstat(fd, &status) != 0 || status.st_size == 0) {
+			if (fd >= 0)
+				::close(fd);
+			fail();
+		}
+		void* const view = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);
+		if (view == MAP_FAILED)
+			fail();
+		data = static_cast<std::byte const*>(view);
+		size = static_cast<std::size_t>(status.st_size);
+#endif
+	}
+
+	~Mapping() { close(); }
+
+	void close() {
+#if defined(_WIN32)
+		if (data != nullptr)
+			UnmapViewOfFile(data);
+		if (view != nullptr)
+			CloseHandle(view);
+		if (file != INVALID_HANDLE_VALUE)
+			CloseHandle(file);
+		view = nullptr;
+		file = INVALID_HANDLE_VALUE;
+#else
+		if (data != nullptr)
+			::munmap(const_cast<std::byte*>(data), size);
+#endif
+		data = nullptr;
+	}
+};
+
+
+
+/*! The index is sized to the next power of two at least twice the formula count. */
+void FormulaLibrary::write(std::filesystem::path const& path, ExpressionEvaluator& evaluator, std::vector<std::pair<name_type, expression_type>> const& formulas) {
+	std::set<std::string_view> seen;
+	std::string names;
+	std::string programs;
+	std::vector<Bucket> index(std::bit_ceil(std::max<std::size_t>(2 * formulas.size(), 1)));
+	for (auto const& [name, expression] : formulas) {
+		if (name.empty() || !seen.insert(name).second)
+			throw std::runtime_error("Error: duplicate or empty formula name '" + name + "'");
+		std::ostringstream program(std::ios::binary);
+		evaluator.save(evaluator.compile(expression), program);
+		auto const bytes = program.str();
+
+		Bucket bucket{ name_hash(name), std::uint32_t(names.size()), std::uint32_t(name.size()), programs.size(), bytes.size() };
+		names += name;
+		programs += bytes;
+		auto slot = bucket.hash & (index.size() - 1);
+		while (index[slot].programSize != 0)
+			slot = (slot + 1) & (index.size() - 1);
+		index[slot] = bucket;
+	}
+
+	auto const indexBytes = index.size() * sizeof(Bucket);
+	LibraryHeader header{ { LIBRARY_MAGIC[0], LIBRARY_MAGIC[1], LIBRARY_MAGIC[2], LIBRARY_MAGIC[3] }, LIBRARY_VERSION, BYTE_ORDER_MARK,
+		std::uint32_t(formulas.size()), std::uint32_t(index.size()),
+		sizeof(LibraryHeader) + indexBytes, names.size(), sizeof(LibraryHeader) + indexBytes + names.size(), programs.size() };
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+	file.write(reinterpret_cast<char const*>(index.data()), indexBytes);
+	file.write(names.data(), names.size());
+	file.write(programs.data(), programs.size());
+	if (!file.flush())
+		throw std::runtime_error("Error: cannot write formula library " + path.string());
+}
+
+
+
+/*! Only the header is read; the index, names and programs are used in place. */
+FormulaLibrary::FormulaLibrary(std::filesystem::path const& path) : mapping_m(std::make_unique<Mapping>(path)) {
+	auto const bytes = std::span(mapping_m->data, mapping_m->size);
+	auto fail = [&](char const* problem) { throw std::runtime_error(std::string("Error: ") + problem + " in formula library " + path.string()); };
+
+	LibraryHeader header;
+	if (bytes.size() < sizeof(header))
+		fail("truncated header");
+	std::memcpy(&header, bytes.data(), sizeof(header));
+	if (!std::equal(std::begin(LIBRARY_MAGIC), std::end(LIBRARY_MAGIC), header.magic))
+		fail("bad magic number");
+	if (header.version != LIBRARY_VERSION || header.byteOrder != BYTE_ORDER_MARK)
+		fail("unsupported version or byte order");
+	auto const indexBytes = std::uint64_t(header.bucketCount) * sizeof(Bucket);
+	if (!std::has_single_bit(header.bucketCount) || std::uint64_t(header.formulaCount) * 2 > header.bucketCount
+		|| header.namesOffset != sizeof(header) + indexBytes
+		|| header.programsOffset != header.namesOffset + header.namesSize
+		|| header.programsOffset + header.programsSize != bytes.size())
+		fail("inconsistent sizes");
+
+	index_m = reinterpret_cast<Bucket const*>(bytes.data() + sizeof(header));
+	buckets_m = header.bucketCount;
+	names_m = bytes.subspan(header.namesOffset, header.namesSize);
+	programs_m = bytes.subspan(header.programsOffset, header.programsSize);
+	size_m = header.formulaCount;
+}
+
+FormulaLibrary::~FormulaLibrary() = default;
+
+
+
+[[nodiscard]] std::span<std::byte const> FormulaLibrary::find(std::string_view name) const {
+	auto const hash = name_hash(name);
+	auto const mask = buckets_m - 1;
+	auto slot = hash & mask;
+	for (std::size_t probe = 0; probe < buckets_m; ++probe, slot = (slot + 1) & mask) {
+		auto const& bucket = index_m[slot];
+		if (bucket.programSize == 0)
+			return {};
+		if (bucket.hash == hash && bucket.nameSize == name.size()
+			&& bucket.nameOffset + std::uint64_t(bucket.nameSize) <= names_m.size()
+			&& std::memcmp(names_m.data() + bucket.nameOffset, name.data(), name.size()) == 0) {
+			if (bucket.programOffset + bucket.programSize > programs_m.size())
+				throw std::runtime_error("Error: corrupt formula library index");
+			return programs_m.subspan(bucket.programOffset, bucket.programSize);
+		}
+	}
+	return {};
+}
+
+
+
+[[nodiscard]] Program FormulaLibrary::load(std::string_view name, ExpressionEvaluator& evaluator) const {
+	auto const bytes = find(name);
+	if (bytes.empty())
+		throw std::runtime_error("Error: no formula named '" + std::string(name) + "'");
+	return evaluator.load(bytes);
+}
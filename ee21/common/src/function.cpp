@@ -11,6 +11,12 @@ Declarations of the Function classes derived from Operation.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Implemented perform() for the concrete functions, added If.
+	Transcendental functions use the argument-reducing implementations in transcendental.hpp.
+	Added FunctionCache; the Real-valued functions, Arctan2 and Pow consult it.
+	Result reads the history of the active EvaluationContext.
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -44,7 +50,325 @@ the program(s) have been supplied.
 
 
 #include <ee/function.hpp>
+#include <ee/boolean.hpp>
 #include <ee/integer.hpp>
+#include <ee/operator.hpp>
+#include <ee/real.hpp>
+#include <ee/transcendental.hpp>
+#include <ee/variable.hpp>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <stdexcept>
+#include <typeindex>
+#include <unordered_map>
+using namespace std;
+
+
+
+// ----------------------------------------------------------------------------
+// Function cache
+// ----------------------------------------------------------------------------
+
+namespace {
+	/*! Cache key: the function type, the Real precision and the dereferenced argument values. */
+	struct CacheKey {
+		type_index function;
+		int digits;
+		vector<Operand::pointer_type> args;
+		size_t hash;
+	};
+
+	[[nodiscard]] size_t hash_of(Operand::pointer_type const& operand) {
+		if (is<Integer>(operand))
+			return std::hash<Integer::value_type>{}(value_of<Integer>(operand));
+		if (is<Real>(operand))
+			return std::hash<Real::value_type>{}(value_of<Real>(operand));
+		if (is<Boolean>(operand))
+			return std::hash<bool>{}(value_of<Boolean>(operand));
+		return type_index(typeid(*operand)).hash_code();
+	}
+
+	[[nodiscard]] bool same_value(Operand::pointer_type const& lhs, Operand::pointer_type const& rhs) {
+		if (is<Integer>(lhs))
+			return is<Integer>(rhs) && value_of<Integer>(lhs) == value_of<Integer>(rhs);
+		if (is<Real>(lhs))
+			return is<Real>(rhs) && value_of<Real>(lhs) == value_of<Real>(rhs);
+		if (is<Boolean>(lhs))
+			return is<Boolean>(rhs) && value_of<Boolean>(lhs) == value_of<Boolean>(rhs);
+		return lhs == rhs;
+	}
+
+	[[nodiscard]] CacheKey make_key(Function const& function, ArgumentList args) {
+		CacheKey key{ type_index(typeid(function)), numeric_limits<Real::value_type>::digits10, {}, 0 };
+		key.hash = key.function.hash_code() ^ size_t(key.digits);
+		for (auto const& arg : args) {
+			key.args.push_back(dereference(arg));
+			key.hash = key.hash * 1'000'003 ^ hash_of(key.args.back());
+		}
+		return key;
+	}
+
+	struct CacheKeyHash {
+		size_t operator () (CacheKey const& key) const { return key.hash; }
+	};
+
+	struct CacheKeyEqual {
+		bool operator () (CacheKey const& lhs, CacheKey const& rhs) const {
+			if (lhs.hash != rhs.hash || lhs.function != rhs.function || lhs.digits != rhs.digits || lhs.args.size() != rhs.args.size())
+				return false;
+			for (size_t i = 0; i < lhs.args.size(); ++i)
+				if (!same_value(lhs.args[i], rhs.args[i]))
+					return false;
+			return true;
+		}
+	};
+
+	/*! LRU store behind FunctionCache: 'order' runs most to least recently used. */
+	struct CacheState {
+		using order_type = list<pair<CacheKey, Operand::pointer_type>>;
+		mutex guard;
+		atomic<size_t> capacity{ 0 };
+		order_type order;
+		unordered_map<CacheKey, order_type::iterator, CacheKeyHash, CacheKeyEqual> index;
+		FunctionCache::Statistics statistics;
+
+		void evict_to(size_t entries) {
+			while (order.size() > entries) {
+				index.erase(order.back().first);
+				order.pop_back();
+				++statistics.evictions;
+			}
+		}
+	};
+
+	[[nodiscard]] CacheState& cache_state() {
+		static CacheState state;
+		return state;
+	}
+}
+
+
+
+size_t FunctionCache::capacity() {
+	return cache_state().capacity.load();
+}
+
+void FunctionCache::set_capacity(size_t entries) {
+	auto& state = cache_state();
+	lock_guard lock(state.guard);
+	state.capacity = entries;
+	state.evict_to(entries);
+}
+
+size_t FunctionCache::size() {
+	auto& state = cache_state();
+	lock_guard lock(state.guard);
+	return state.order.size();
+}
+
+FunctionCache::Statistics FunctionCache::statistics() {
+	auto& state = cache_state();
+	lock_guard lock(state.guard);
+	return state.statistics;
+}
+
+void FunctionCache::clear() {
+	auto& state = cache_state();
+	lock_guard lock(state.guard);
+	state.index.clear();
+	state.order.clear();
+	state.statistics = Statistics();
+}
+
+Operand::pointer_type FunctionCache::find(Function const& function, ArgumentList args) {
+	auto& state = cache_state();
+	if (state.capacity == 0)
+		return nullptr;
+	auto key = make_key(function, args);
+
+	lock_guard lock(state.guard);
+	auto it = state.index.find(key);
+	if (it == state.index.end()) {
+		++state.statistics.misses;
+		return nullptr;
+	}
+	++state.statistics.hits;
+	state.order.splice(state.order.begin(), state.order, it->second);
+	return it->second->second;
+}
+
+void FunctionCache::insert(Function const& function, ArgumentList args, Operand::pointer_type const& result) {
+	auto& state = cache_state();
+	if (state.capacity == 0)
+		return;
+	auto key = make_key(function, args);
+
+	lock_guard lock(state.guard);
+	if (state.capacity == 0 || state.index.contains(key))
+		return;
+	state.order.emplace_front(std::move(key), result);
+	state.index.emplace(state.order.front().first, state.order.begin());
+	state.evict_to(state.capacity);
+}
+
+
+
+namespace {
+	/*! Returns the cached value of 'function' on 'args', or computes and caches it with 'compute'. */
+	template <typename COMPUTE>
+	[[nodiscard]] Operand::pointer_type memoized(Function const& function, ArgumentList args, COMPUTE compute) {
+		if (auto cached = FunctionCache::find(function, args))
+			return cached;
+		auto result = compute();
+		FunctionCache::insert(function, args, result);
+		return result;
+	}
+
+
+
+	/*! Performs a real-valued function on a numeric argument. */
+	template <typename REAL_OP>
+	[[nodiscard]] Operand::pointer_type real_function(Function const& function, ArgumentList args, REAL_OP realOp) {
+		return memoized(function, args, [&] {
+			return make_operand<Real>(Real::value_type(realOp(real_value_of(dereference(args[0])))));
+		});
+	}
+
+
+
+	/*! Selects one of two numeric arguments, promoting to Real unless both are Integers. */
+	template <typename PREDICATE>
+	[[nodiscard]] Operand::pointer_type select(ArgumentList args, PREDICATE firstWins) {
+		auto lhs = dereference(args[0]);
+		auto rhs = dereference(args[1]);
+		if (is<Integer>(lhs) && is<Integer>(rhs))
+			return firstWins(value_of<Integer>(lhs), value_of<Integer>(rhs)) ? lhs : rhs;
+		auto l = real_value_of(lhs);
+		auto r = real_value_of(rhs);
+		return make_operand<Real>(firstWins(l, r) ? l : r);
+	}
+}
+
+
+
+// ----------------------------------------------------------------------------
+// One argument functions
+// ----------------------------------------------------------------------------
+
+DEF_OPERATION_PERFORM(Abs) {
+	auto operand = dereference(args[0]);
+	if (is<Integer>(operand))
+		return make_operand<Integer>(Integer::value_type(abs(value_of<Integer>(operand))));
+	return make_operand<Real>(Real::value_type(abs(real_value_of(operand))));
+}
+
+DEF_OPERATION_PERFORM(Arccos) {
+	return real_function(*this, args, [](auto const& x) { return transcendental::acos(x); });
+}
+
+DEF_OPERATION_PERFORM(Arcsin) {
+	return real_function(*this, args, [](auto const& x) { return transcendental::asin(x); });
+}
+
+DEF_OPERATION_PERFORM(Arctan) {
+	return real_function(*this, args, [](auto const& x) { return transcendental::atan(x); });
+}
+
+DEF_OPERATION_PERFORM(Ceil) {
+	auto operand = dereference(args[0]);
+	if (is<Integer>(operand))
+		return operand;
+	return make_operand<Real>(Real::value_type(ceil(real_value_of(operand))));
+}
+
+DEF_OPERATION_PERFORM(Cos) {
+	return real_function(*this, args, [](auto const& x) { return transcendental::cos(x); });
+}
+
+DEF_OPERATION_PERFORM(Exp) {
+	return real_function(*this, args, [](auto const& x) { return exp(x); });
+}
+
+DEF_OPERATION_PERFORM(Floor) {
+	auto operand = dereference(args[0]);
+	if (is<Integer>(operand))
+		return operand;
+	return make_operand<Real>(Real::value_type(floor(real_value_of(operand))));
+}
+
+DEF_OPERATION_PERFORM(Lb) {
+	return real_function(*this, args, [](auto const& x) { return transcendental::log2(x); });
+}
+
+DEF_OPERATION_PERFORM(Ln) {
+	return real_function(*this, args, [](auto const& x) { return transcendental::log(x); });
+}
+
+DEF_OPERATION_PERFORM(Log) {
+	return real_function(*this, args, [](auto const& x) { return transcendental::log10(x); });
+}
+
+DEF_OPERATION_PERFORM(Result) {
+	auto index = dereference(args[0]);
+	if (!is<Integer>(index))
+		throw runtime_error("Error: result index must be an integer");
+	auto n = value_of<Integer>(index);
+	auto context = EvaluationContext::active();
+	if (context == nullptr || n < 1 || n > context->result_count())
+		throw runtime_error("Error: result index out of range");
+	return context->result(n.convert_to<ResultHistory::index_type>());
+}
+
+DEF_OPERATION_PERFORM(Sin) {
+	return real_function(*this, args, [](auto const& x) { return transcendental::sin(x); });
+}
+
+DEF_OPERATION_PERFORM(Sqrt) {
+	return real_function(*this, args, [](auto const& x) { return sqrt(x); });
+}
+
+DEF_OPERATION_PERFORM(Tan) {
+	return real_function(*this, args, [](auto const& x) { return transcendental::tan(x); });
+}
+
+
+
+// ----------------------------------------------------------------------------
+// Two argument functions
+// ----------------------------------------------------------------------------
+
+DEF_OPERATION_PERFORM(Arctan2) {
+	return memoized(*this, args, [&] {
+		return make_operand<Real>(Real::value_type(transcendental::atan2(real_value_of(dereference(args[0])), real_value_of(dereference(args[1])))));
+	});
+}
+
+DEF_OPERATION_PERFORM(Max) {
+	return select(args, [](auto const& l, auto const& r) { return l >= r; });
+}
+
+DEF_OPERATION_PERFORM(Min) {
+	return select(args, [](auto const& l, auto const& r) { return l <= r; });
+}
+
+DEF_OPERATION_PERFORM(Pow) {
+	return memoized(*this, args, [&] { return Power().perform(args); });
+}
+
 
 
+// ----------------------------------------------------------------------------
+// Three argument functions
+// ----------------------------------------------------------------------------
 
+/*! Eager form of the conditional, used when the arguments have already been evaluated.
+	The parser normally replaces if(c,a,b) with JumpIfFalse/Jump so this is not reached. */
+DEF_OPERATION_PERFORM(If) {
+	auto condition = dereference(args[0]);
+	if (!is<Boolean>(condition))
+		throw runtime_error("Error: condition must be a boolean");
+	return value_of<Boolean>(condition) ? args[1] : args[2];
+}
@@ -0,0 +1,149 @@
+/*!	\file	incremental_program.cpp
+	\brief	IncrementalProgram class implementation.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/incremental_program.hpp>
+#include <ee/boolean.hpp>
+#include <ee/function.hpp>
+#include <ee/operation.hpp>
+#include <ee/operator.hpp>
+#include <ee/pseudo_operation.hpp>
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+
+
+IncrementalProgram::IncrementalProgram(Program const& program) {
+	auto const& tokens = program.tokens();
+	root_m = build(tokens, 0, tokens.size());
+	reads_m = nodes_m[root_m].reads;
+	isVolatile_m = nodes_m[root_m].isVolatile;
+}
+
+
+
+/*! Builds the tree for the postfix tokens [begin, end), which must leave exactly one value.
+	c JumpIfFalse(b) a Jump(end) b becomes a single node with the children c, a and b.
+	@return the index of the root node.
+*/
+[[nodiscard]] std::size_t IncrementalProgram::build(TokenList const& tokens, std::size_t begin, std::size_t end) {
+	std::vector<std::size_t> stack;
+	for (std::size_t i = begin; i < end; ++i) {
+		auto const& tk = tokens[i];
+		if (is<Operand>(tk))
+			stack.push_back(add_node(tk, {}));
+		else if (is<JumpIfFalse>(tk)) {
+			auto const elseBegin = convert<Jump>(tk)->target();
+			auto const elseEnd = convert<Jump>(tokens[elseBegin - 1])->target();
+			auto const condition = stack.back();
+			stack.pop_back();
+			auto const whenTrue = build(tokens, i + 1, elseBegin - 1);
+			auto const whenFalse = build(tokens, elseBegin, elseEnd);
+			stack.push_back(add_node(nullptr, { condition, whenTrue, whenFalse }));
+			i = elseEnd - 1;
+		}
+		else {
+			auto const nArgs = static_cast<Operation const*>(tk.get())->number_of_args();
+			assert(nArgs <= stack.size());
+			std::vector<std::size_t> children(stack.end() - nArgs, stack.end());
+			stack.resize(stack.size() - nArgs);
+			stack.push_back(add_node(tk, std::move(children)));
+		}
+	}
+	assert(stack.size() == 1);
+	return stack.back();
+}
+
+
+
+/*! Appends a node, collecting the variables its sub-tree reads. */
+[[nodiscard]] std::size_t IncrementalProgram::add_node(Token::pointer_type const& token, std::vector<std::size_t> children) {
+	Node node;
+	node.token = token;
+	node.isVolatile = is<Result>(token);
+	if (is<Variable>(token))
+		node.reads.push_back(static_cast<Variable const*>(token.get()));
+
+	bool const isAssignment = is<Assignment>(token);
+	for (std::size_t i = 0; i < children.size(); ++i) {
+		auto const& child = nodes_m[children[i]];
+		node.isVolatile = node.isVolatile || child.isVolatile;
+		if (isAssignment && i == 0 && is<Variable>(child.token))
+			continue;
+		node.reads.insert(node.reads.end(), child.reads.begin(), child.reads.end());
+	}
+	std::sort(node.reads.begin(), node.reads.end());
+	node.reads.erase(std::unique(node.reads.begin(), node.reads.end()), node.reads.end());
+
+	node.children = std::move(children);
+	nodes_m.push_back(std::move(node));
+	return nodes_m.size() - 1;
+}
+
+
+
+[[nodiscard]] bool IncrementalProgram::is_dirty(std::size_t node) const {
+	auto const& n = nodes_m[node];
+	if (n.isVolatile || !n.value)
+		return true;
+	return std::any_of(n.reads.begin(), n.reads.end(), [&](Variable const* variable) { return variable->version() > n.evaluated; });
+}
+
+
+
+[[nodiscard]] Operand::pointer_type IncrementalProgram::evaluate() {
+	recomputed_m = 0;
+	return evaluate(root_m);
+}
+
+
+
+/*! Returns the node's cached value, recomputing it first if the node is dirty. */
+[[nodiscard]] Operand::pointer_type IncrementalProgram::evaluate(std::size_t node) {
+	if (!is_dirty(node))
+		return nodes_m[node].value;
+
+	auto const stamp = Variable::last_version();
+	auto& n = nodes_m[node];
+	if (!n.token) {
+		auto condition = dereference(evaluate(n.children[0]));
+		if (!is<Boolean>(condition))
+			throw std::runtime_error("Error: condition must be a boolean");
+		n.value = evaluate(n.children[value_of<Boolean>(condition) ? 1 : 2]);
+	}
+	else if (is<Operand>(n.token))
+		n.value = std::static_pointer_cast<Operand>(n.token);
+	else {
+		std::vector<Operand::pointer_type> args;
+		args.reserve(n.children.size());
+		for (auto child : n.children)
+			args.push_back(evaluate(child));
+		n.value = static_cast<Operation const*>(n.token.get())->perform(ArgumentList(args));
+		++recomputed_m;
+	}
+	n.evaluated = stamp;
+	return n.value;
+}
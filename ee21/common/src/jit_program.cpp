@@ -0,0 +1,311 @@
+/*!	\file	jit_program.cpp
+	\brief	JitProgram class implementation.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/jit_program.hpp>
+#include <ee/integer.hpp>
+#include <ee/operator.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define EE_JIT_X64 1
+#else
+#define EE_JIT_X64 0
+#endif
+
+#if EE_JIT_X64
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#endif
+#endif
+
+
+
+namespace {
+	/*! Signature of the generated code: reads the inputs, stores the value in 'result'.
+		@return 1 on success, 0 if an operation overflowed or divided by 0 or -1. */
+	using native_type = int (*)(std::int64_t const* inputs, std::int64_t* result);
+
+	Integer::value_type const int64Min = std::numeric_limits<std::int64_t>::min();
+	Integer::value_type const int64Max = std::numeric_limits<std::int64_t>::max();
+
+	[[nodiscard]] std::optional<std::int64_t> to_int64(Integer::value_type const& value) {
+		if (value < int64Min || value > int64Max)
+			return std::nullopt;
+		return value.convert_to<std::int64_t>();
+	}
+
+
+
+#if EE_JIT_X64
+	/*! Emits the x86-64 code of a stack machine that keeps its operands on the native stack.
+		Only volatile registers are used: r10 = inputs, r11 = result, r9 = entry stack pointer. */
+	class Emitter {
+		std::vector<std::uint8_t>	code_m;
+		std::vector<std::size_t>	bails_m;	// rel32 fields of the jumps to the bail-out
+	public:
+		Emitter() {
+#if defined(_WIN32)
+			emit({ 0x49, 0x89, 0xCA });			// mov r10, rcx
+			emit({ 0x49, 0x89, 0xD3 });			// mov r11, rdx
+#else
+			emit({ 0x49, 0x89, 0xFA });			// mov r10, rdi
+			emit({ 0x49, 0x89, 0xF3 });			// mov r11, rsi
+#endif
+			emit({ 0x49, 0x89, 0xE1 });			// mov r9, rsp
+		}
+
+		void literal(std::int64_t value) {
+			emit({ 0x48, 0xB8 });				// mov rax, imm64
+			emit_bytes(value);
+			emit({ 0x50 });						// push rax
+		}
+
+		void input(std::size_t index) {
+			emit({ 0x49, 0x8B, 0x82 });			// mov rax, [r10 + disp32]
+			emit_bytes(static_cast<std::int32_t>(index * sizeof(std::int64_t)));
+			emit({ 0x50 });						// push rax
+		}
+
+		void negate() {
+			emit({ 0x58 });						// pop rax
+			emit({ 0x48, 0xF7, 0xD8 });			// neg rax
+			bail_if(0x80);						// jo
+			emit({ 0x50 });						// push rax
+		}
+
+		/*! 'operation' is one of + - * / %. */
+		void binary(char operation) {
+			emit({ 0x59, 0x58 });				// pop rcx; pop rax
+			switch (operation) {
+			case '+': emit({ 0x48, 0x01, 0xC8 }); bail_if(0x80); break;			// add rax, rcx; jo
+			case '-': emit({ 0x48, 0x29, 0xC8 }); bail_if(0x80); break;			// sub rax, rcx; jo
+			case '*': emit({ 0x48, 0x0F, 0xAF, 0xC1 }); bail_if(0x80); break;	// imul rax, rcx; jo
+			default:
+				emit({ 0x48, 0x85, 0xC9 }); bail_if(0x84);			// test rcx, rcx; jz
+				emit({ 0x48, 0x83, 0xF9, 0xFF }); bail_if(0x84);	// cmp rcx, -1; je
+				emit({ 0x48, 0x99, 0x48, 0xF7, 0xF9 });				// cqo; idiv rcx
+				if (operation == '%')
+					emit({ 0x48, 0x89, 0xD0 });						// mov rax, rdx
+			}
+			emit({ 0x50 });						// push rax
+		}
+
+		/*! Finishes the function and returns its code. */
+		[[nodiscard]] std::vector<std::uint8_t> finish() {
+			emit({ 0x58 });						// pop rax
+			emit({ 0x49, 0x89, 0x03 });			// mov [r11], rax
+			emit({ 0xB8, 0x01, 0x00, 0x00, 0x00, 0xC3 });	// mov eax, 1; ret
+			auto const bail = code_m.size();
+			for (auto field : bails_m) {
+				auto const offset = static_cast<std::int32_t>(bail - (field + 4));
+				std::memcpy(code_m.data() + field, &offset, sizeof offset);
+			}
+			emit({ 0x4C, 0x89, 0xCC });			// mov rsp, r9
+			emit({ 0x31, 0xC0, 0xC3 });			// xor eax, eax; ret
+			return std::move(code_m);
+		}
+
+	private:
+		void emit(std::initializer_list<std::uint8_t> bytes) { code_m.insert(code_m.end(), bytes); }
+
+		template <typename T>
+		void emit_bytes(T value) {
+			std::uint8_t bytes[sizeof(T)];
+			std::memcpy(bytes, &value, sizeof(T));
+			code_m.insert(code_m.end(), bytes, bytes + sizeof(T));
+		}
+
+		/*! Jcc rel32 to the bail-out; 'condition' is the second opcode byte. */
+		void bail_if(std::uint8_t condition) {
+			emit({ 0x0F, condition });
+			bails_m.push_back(code_m.size());
+			emit_bytes(std::int32_t(0));
+		}
+	};
+#endif
+}
+
+
+
+/*! Executable copy of the generated code. */
+struct JitProgram::Code {
+	void*		memory = nullptr;
+	std::size_t	size = 0;
+
+	explicit Code(std::vector<std::uint8_t> const& code) : size(code.size()) {
+#if EE_JIT_X64
+#if defined(_WIN32)
+		memory = VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+		if (memory == nullptr)
+			throw std::runtime_error("Error: cannot allocate executable memory");
+		std::memcpy(memory, code.data(), size);
+		DWORD previous;
+		if (!VirtualProtect(memory, size, PAGE_EXECUTE_READ, &previous)) {
+			VirtualFree(memory, 0, MEM_RELEASE);
+			throw std::runtime_error("Error: cannot allocate executable memory");
+		}
+		FlushInstructionCache(GetCurrentProcess(), memory, size);
+#else
+		memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (memory == MAP_FAILED)
+			throw std::runtime_error("Error: cannot allocate executable memory");
+		std::memcpy(memory, code.data(), size);
+		if (::mprotect(memory, size, PROT_READ | PROT_EXEC) != 0) {
+			::munmap(memory, size);
+			throw std::runtime_error("Error: cannot allocate executable memory");
+		}
+#endif
+#endif
+	}
+
+	~Code() {
+#if EE_JIT_X64
+#if defined(_WIN32)
+		VirtualFree(memory, 0, MEM_RELEASE);
+#else
+		::munmap(memory, size);
+#endif
+#endif
+	}
+
+	[[nodiscard]] native_type function() const { return reinterpret_cast<native_type>(memory); }
+};
+
+
+
+JitProgram::JitProgram(Program program, std::uint64_t threshold) : program_m(std::move(program)), threshold_m(threshold) {
+	if (threshold_m == 0)
+		compile();
+}
+
+JitProgram::~JitProgram() = default;
+
+
+
+[[nodiscard]] bool JitProgram::is_supported() {
+	return EE_JIT_X64 != 0;
+}
+
+
+
+/*! Generates native code if every token of the program has an integer translation.
+	Programs that consist of a single operand are left to the interpreter, which returns the
+	operand itself. */
+void JitProgram::compile() {
+	attempted_m = true;
+#if EE_JIT_X64
+	auto const& tokens = program_m.tokens();
+	if (tokens.size() < 2)
+		return;
+
+	Emitter emitter;
+	std::vector<Variable const*> inputs;
+	for (auto const& token : tokens) {
+		if (is<Integer>(token)) {
+			auto const value = to_int64(value_of<Integer>(token));
+			if (!value)
+				return;
+			emitter.literal(*value);
+		}
+		else if (is<Variable>(token)) {
+			auto const variable = static_cast<Variable const*>(token.get());
+			auto found = std::find(inputs.begin(), inputs.end(), variable);
+			if (found == inputs.end())
+				found = inputs.insert(inputs.end(), variable);
+			emitter.input(found - inputs.begin());
+		}
+		else if (is<Identity>(token))
+			;
+		else if (is<Negation>(token))
+			emitter.negate();
+		else if (is<Addition>(token))
+			emitter.binary('+');
+		else if (is<Subtraction>(token))
+			emitter.binary('-');
+		else if (is<Multiplication>(token))
+			emitter.binary('*');
+		else if (is<Division>(token))
+			emitter.binary('/');
+		else if (is<Modulus>(token))
+			emitter.binary('%');
+		else
+			return;
+	}
+
+	code_m = std::make_unique<Code>(emitter.finish());
+	inputs_m = std::move(inputs);
+	arguments_m.resize(inputs_m.size());
+#endif
+}
+
+
+
+/*! Copies the values of the inputs into arguments_m.
+	@return false if an input is not an Integer that fits in 64 bits. */
+[[nodiscard]] bool JitProgram::load_arguments() {
+	for (std::size_t i = 0; i < inputs_m.size(); ++i) {
+		auto const& value = inputs_m[i]->value();
+		if (!is<Integer>(value))
+			return false;
+		auto const argument = to_int64(static_cast<Integer const*>(value.get())->value());
+		if (!argument)
+			return false;
+		arguments_m[i] = *argument;
+	}
+	return true;
+}
+
+
+
+/*! Runs the native code when the program is compiled and the inputs fit; otherwise, or when
+	the native code bails out, the interpreter produces the value and any error. */
+[[nodiscard]] Operand::pointer_type JitProgram::evaluate(EvaluationContext& context) {
+	if (++evaluations_m >= threshold_m && !attempted_m)
+		compile();
+
+	if (code_m) {
+		EvaluationContext::Scope scope(context);
+		std::int64_t value;
+		if (load_arguments() && code_m->function()(arguments_m.data(), &value)) {
+			auto result = make_operand<Integer>(Integer::value_type(value));
+			context.add_result(result);
+			return result;
+		}
+	}
+	return rpn_m.evaluate(program_m, context);
+}
@@ -12,6 +12,13 @@ supporting utilities.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Implemented perform() for the concrete operators.
+	Factorial uses a small-n table, binary splitting, and optional threaded partial products.
+	Power has exact integer-exponent fast paths.
+	Integer powers are limited to Power::max_result_bits.
+	Power with a fractional exponent uses transcendental::pow().
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -42,9 +49,326 @@ the program(s) have been supplied.
 
 #include <ee/operator.hpp>
 #include <ee/operand.hpp>
+#include <ee/boolean.hpp>
 #include <ee/integer.hpp>
 #include <ee/real.hpp>
+#include <ee/transcendental.hpp>
 #include <ee/variable.hpp>
+#include <array>
 #include <cassert>
+#include <future>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+using namespace std;
+
+
+
+namespace {
+	/*! Checks that an operand is an Integer or a Real. */
+	[[nodiscard]] bool is_number(Operand::pointer_type const& operand) {
+		return is<Integer>(operand) || is<Real>(operand);
+	}
+
+
+
+	/*! Performs a numeric binary operation on the dereferenced arguments.
+		Integer operands use 'integerOp', mixed or real operands are promoted to Real and use 'realOp'. */
+	template <typename INTEGER_OP, typename REAL_OP>
+	[[nodiscard]] Operand::pointer_type numeric(ArgumentList args, INTEGER_OP integerOp, REAL_OP realOp) {
+		auto lhs = dereference(args[0]);
+		auto rhs = dereference(args[1]);
+		if (is<Integer>(lhs) && is<Integer>(rhs))
+			return integerOp(value_of<Integer>(lhs), value_of<Integer>(rhs));
+		if (is_number(lhs) && is_number(rhs))
+			return realOp(real_value_of(lhs), real_value_of(rhs));
+		throw runtime_error("Error: operands must be numbers");
+	}
+
+
+
+	/*! Performs a logical binary operation on the dereferenced arguments. */
+	template <typename BOOLEAN_OP>
+	[[nodiscard]] Operand::pointer_type logical(ArgumentList args, BOOLEAN_OP booleanOp) {
+		auto lhs = dereference(args[0]);
+		auto rhs = dereference(args[1]);
+		if (!is<Boolean>(lhs) || !is<Boolean>(rhs))
+			throw runtime_error("Error: operands must be booleans");
+		return make_operand<Boolean>(booleanOp(value_of<Boolean>(lhs), value_of<Boolean>(rhs)));
+	}
+
+
+
+	/*! Performs a numeric comparison, or a boolean comparison (false < true) of two booleans. */
+	template <typename COMPARE_OP>
+	[[nodiscard]] Operand::pointer_type compare(ArgumentList args, COMPARE_OP compareOp) {
+		auto lhs = dereference(args[0]);
+		auto rhs = dereference(args[1]);
+		if (is<Boolean>(lhs) && is<Boolean>(rhs))
+			return make_operand<Boolean>(compareOp(value_of<Boolean>(lhs), value_of<Boolean>(rhs)));
+		return numeric(args,
+			[&](Integer::value_type const& l, Integer::value_type const& r) { return make_operand<Boolean>(compareOp(l, r)); },
+			[&](Real::value_type const& l, Real::value_type const& r) { return make_operand<Boolean>(compareOp(l, r)); });
+	}
+}
+
+
+
+// ----------------------------------------------------------------------------
+// Binary operators
+// ----------------------------------------------------------------------------
+
+DEF_OPERATION_PERFORM(Addition) {
+	return numeric(args,
+		[](auto const& l, auto const& r) { return make_operand<Integer>(l + r); },
+		[](auto const& l, auto const& r) { return make_operand<Real>(l + r); });
+}
+
+DEF_OPERATION_PERFORM(Subtraction) {
+	return numeric(args,
+		[](auto const& l, auto const& r) { return make_operand<Integer>(l - r); },
+		[](auto const& l, auto const& r) { return make_operand<Real>(l - r); });
+}
+
+DEF_OPERATION_PERFORM(Multiplication) {
+	return numeric(args,
+		[](auto const& l, auto const& r) { return make_operand<Integer>(l * r); },
+		[](auto const& l, auto const& r) { return make_operand<Real>(l * r); });
+}
+
+DEF_OPERATION_PERFORM(Division) {
+	return numeric(args,
+		[](auto const& l, auto const& r) {
+			if (r == 0)
+				throw runtime_error("Error: division by zero");
+			return make_operand<Integer>(Integer::value_type(l / r));
+		},
+		[](auto const& l, auto const& r) { return make_operand<Real>(Real::value_type(l / r)); });
+}
+
+DEF_OPERATION_PERFORM(Modulus) {
+	return numeric(args,
+		[](auto const& l, auto const& r) {
+			if (r == 0)
+				throw runtime_error("Error: division by zero");
+			return make_operand<Integer>(Integer::value_type(l % r));
+		},
+		[](auto const& l, auto const& r) { return make_operand<Real>(Real::value_type(fmod(l, r))); });
+}
+
+namespace {
+	/*! Non-negative integer power by square-and-multiply, with a single shift for powers of two.
+		Bases 0, 1, and -1 accept exponents of any size; other results are limited to
+		Power::max_result_bits, estimated as the bits of the base times the exponent. */
+	[[nodiscard]] Integer::value_type integer_power(Integer::value_type const& base, Integer::value_type const& exponent) {
+		assert(exponent >= 0);
+		if (base == 0)
+			return exponent == 0 ? 1 : 0;
+		if (base == 1)
+			return 1;
+		if (base == -1)
+			return bit_test(exponent, 0) ? -1 : 1;
+
+		Integer::value_type const magnitude = abs(base);
+		auto const shift = lsb(magnitude);
+		bool const powerOfTwo = magnitude == Integer::value_type(1) << shift;
+		auto const bitsPerFactor = powerOfTwo ? shift : msb(magnitude) + 1;
+		if (exponent > Power::max_result_bits.load() / bitsPerFactor || exponent > numeric_limits<unsigned>::max())
+			throw runtime_error("Error: power result too large");
+
+		auto const e = exponent.convert_to<unsigned>();
+		if (powerOfTwo) {
+			Integer::value_type result = Integer::value_type(1) << (uint64_t(shift) * e);
+			return base < 0 && e % 2 ? Integer::value_type(-result) : result;
+		}
+		return pow(base, e);
+	}
+}
+
+DEF_OPERATION_PERFORM(Power) {
+	auto lhs = dereference(args[0]);
+	auto rhs = dereference(args[1]);
+	if (is<Integer>(rhs)) {
+		auto const exponent = value_of<Integer>(rhs);
+		if (is<Integer>(lhs)) {
+			if (exponent >= 0)
+				return make_operand<Integer>(integer_power(value_of<Integer>(lhs), exponent));
+			auto const denominator = integer_power(value_of<Integer>(lhs), -exponent);
+			if (denominator == 0)
+				throw runtime_error("Error: division by zero");
+			return make_operand<Real>(Real::value_type(1) / Real::value_type(denominator));
+		}
+		// Real base: boost's integer pow() squares without the exp/log of the real pow()
+		if (is<Real>(lhs) && abs(exponent) <= numeric_limits<long long>::max())
+			return make_operand<Real>(Real::value_type(pow(value_of<Real>(lhs), exponent.convert_to<long long>())));
+	}
+	if (!is_number(lhs) || !is_number(rhs))
+		throw runtime_error("Error: operands must be numbers");
+	return make_operand<Real>(transcendental::pow(real_value_of(lhs), real_value_of(rhs)));
+}
+
+
+
+DEF_OPERATION_PERFORM(Assignment) {
+	if (!is<Variable>(args[0]))
+		throw runtime_error("Error: assignment to a non-variable.");
+	convert<Variable>(args[0])->set(dereference(args[1]));
+	return args[0];
+}
+
+DEF_OPERATION_PERFORM(And) {
+	return logical(args, [](bool l, bool r) { return l && r; });
+}
+
+DEF_OPERATION_PERFORM(Nand) {
+	return logical(args, [](bool l, bool r) { return !(l && r); });
+}
+
+DEF_OPERATION_PERFORM(Nor) {
+	return logical(args, [](bool l, bool r) { return !(l || r); });
+}
+
+DEF_OPERATION_PERFORM(Or) {
+	return logical(args, [](bool l, bool r) { return l || r; });
+}
+
+DEF_OPERATION_PERFORM(Xor) {
+	return logical(args, [](bool l, bool r) { return l != r; });
+}
+
+DEF_OPERATION_PERFORM(Xnor) {
+	return logical(args, [](bool l, bool r) { return l == r; });
+}
+
+DEF_OPERATION_PERFORM(Equality) {
+	return compare(args, [](auto const& l, auto const& r) { return l == r; });
+}
+
+DEF_OPERATION_PERFORM(Inequality) {
+	return compare(args, [](auto const& l, auto const& r) { return l != r; });
+}
+
+DEF_OPERATION_PERFORM(Greater) {
+	return compare(args, [](auto const& l, auto const& r) { return l > r; });
+}
+
+DEF_OPERATION_PERFORM(GreaterEqual) {
+	return compare(args, [](auto const& l, auto const& r) { return l >= r; });
+}
+
+DEF_OPERATION_PERFORM(Less) {
+	return compare(args, [](auto const& l, auto const& r) { return l < r; });
+}
+
+DEF_OPERATION_PERFORM(LessEqual) {
+	return compare(args, [](auto const& l, auto const& r) { return l <= r; });
+}
+
+
+
+// ----------------------------------------------------------------------------
+// Unary operators
+// ----------------------------------------------------------------------------
+
+DEF_OPERATION_PERFORM(Identity) {
+	auto operand = dereference(args[0]);
+	if (!is_number(operand))
+		throw runtime_error("Error: operand must be a number");
+	return operand;
+}
+
+DEF_OPERATION_PERFORM(Negation) {
+	auto operand = dereference(args[0]);
+	if (is<Integer>(operand))
+		return make_operand<Integer>(Integer::value_type(-value_of<Integer>(operand)));
+	if (is<Real>(operand))
+		return make_operand<Real>(Real::value_type(-value_of<Real>(operand)));
+	throw runtime_error("Error: operand must be a number");
+}
+
+DEF_OPERATION_PERFORM(Not) {
+	auto operand = dereference(args[0]);
+	if (!is<Boolean>(operand))
+		throw runtime_error("Error: operand must be a boolean");
+	return make_operand<Boolean>(!value_of<Boolean>(operand));
+}
+
+namespace {
+	/*! 0! through 20!, the factorials that fit in 64 bits. */
+	constexpr auto SMALL_FACTORIALS = [] {
+		array<uint64_t, 21> table{ 1 };
+		for (uint64_t i = 1; i < table.size(); ++i)
+			table[i] = table[i - 1] * i;
+		return table;
+	}();
+
+	/*! The product lo * (lo+1) * ... * hi, for 1 <= lo <= hi, by binary splitting.
+		Leaves pack consecutive factors into a 64-bit word before touching the multiprecision value,
+		and the splitting keeps both operands of each multiprecision multiply about the same size. */
+	[[nodiscard]] Integer::value_type range_product(uint64_t lo, uint64_t hi) {
+		if (hi - lo < 32) {
+			Integer::value_type product = 1;
+			uint64_t word = 1;
+			for (auto i = lo; i <= hi; ++i) {
+				if (word > numeric_limits<uint64_t>::max() / i) {
+					product *= word;
+					word = 1;
+				}
+				word *= i;
+			}
+			return product * word;
+		}
+		auto const mid = lo + (hi - lo) / 2;
+		return range_product(lo, mid) * range_product(mid + 1, hi);
+	}
+
+	/*! range_product() with the range split across 'nThreads' threads, and the partial products
+		combined pairwise, each level of the combining tree also running in parallel. */
+	[[nodiscard]] Integer::value_type parallel_range_product(uint64_t lo, uint64_t hi, unsigned nThreads) {
+		vector<future<Integer::value_type>> pending;
+		uint64_t const step = (hi - lo + 1) / nThreads;
+		for (unsigned i = 0; i < nThreads; ++i) {
+			uint64_t const first = lo + i * step;
+			uint64_t const last = i + 1 == nThreads ? hi : first + step - 1;
+			pending.push_back(async(launch::async, range_product, first, last));
+		}
+
+		vector<Integer::value_type> products;
+		for (auto& part : pending)
+			products.push_back(part.get());
+		while (products.size() > 1) {
+			vector<future<Integer::value_type>> level;
+			for (size_t i = 0; i + 1 < products.size(); i += 2)
+				level.push_back(async(launch::async, [&products, i]() -> Integer::value_type { return products[i] * products[i + 1]; }));
+			vector<Integer::value_type> next;
+			for (auto& product : level)
+				next.push_back(product.get());
+			if (products.size() % 2)
+				next.push_back(move(products.back()));
+			products = move(next);
+		}
+		return products.front();
+	}
+}
+
+DEF_OPERATION_PERFORM(Factorial) {
+	auto operand = dereference(args[0]);
+	if (!is<Integer>(operand))
+		throw runtime_error("Error: factorial requires an integer");
+	auto const n = value_of<Integer>(operand);
+	if (n < 0)
+		throw runtime_error("Error: factorial of a negative number");
+	if (n > max_argument.load())
+		throw runtime_error("Error: factorial argument too large");
 
+	auto const count = n.convert_to<uint64_t>();
+	if (count < SMALL_FACTORIALS.size())
+		return make_operand<Integer>(Integer::value_type(SMALL_FACTORIALS[count]));
 
+	auto const threshold = parallel_threshold.load();
+	auto const nThreads = min<uint64_t>(thread::hardware_concurrency(), count / 1'000);
+	if (threshold != 0 && count >= threshold && nThreads > 1)
+		return make_operand<Integer>(parallel_range_product(2, count, unsigned(nThreads)));
+	return make_operand<Integer>(range_product(2, count));
+}
@@ -7,6 +7,11 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Lowered if(c,a,b) to JumpIfFalse/Jump so only the selected branch is evaluated.
+	Added Program and Parser::compile(); stack depth is computed at parse time.
+	Added parse() with token origins.
+
 Version 2021.11.01
 	C++ 20 validated
 	Changed to GATS_TEST
@@ -39,46 +44,121 @@ the program(s) have been supplied.
 #include <ee/operand.hpp>
 #include <ee/operator.hpp>
 #include <ee/pseudo_operation.hpp>
+#include <algorithm>
+#include <optional>
 #include <stack>
+#include <stdexcept>
 #include <queue>
 #include <string>
+#include <vector>
+
+namespace {
+	/*! An if(c,a,b) call whose argument list is still open. */
+	struct IfCall {
+		std::size_t			depth;			// operator stack size while the call's left-parenthesis is on top
+		std::size_t			origin;			// index of the 'if' token
+		unsigned			separators = 0;
+		Jump::pointer_type	pending;		// jump that targets the next argument boundary
+	};
+}
 
 [[nodiscard]] TokenList Parser::parse(TokenList const& infixTokens) {
+	return _parse(infixTokens, nullptr);
+}
+
+
+
+[[nodiscard]] TokenList Parser::parse(TokenList const& infixTokens, std::vector<std::size_t>& origins) {
+	origins.clear();
+	return _parse(infixTokens, &origins);
+}
+
+
+
+/*! Shunting-yard conversion to postfix, recording the token origins in 'origins', which starts empty, if it is not null. */
+[[nodiscard]] TokenList Parser::_parse(TokenList const& infixTokens, std::vector<std::size_t>* origins) {
 	
 	std::stack<Token::pointer_type> operStack;
+	std::stack<std::size_t> operOrigins;		// infix index of each operStack token
+	std::stack<IfCall> ifCalls;
 	TokenList postfixTokens;
+
+	auto push = [&](Token::pointer_type const& tk, std::size_t origin) {
+		operStack.push(tk);
+		operOrigins.push(origin);
+	};
+	auto pop = [&] {
+		operStack.pop();
+		operOrigins.pop();
+	};
+	auto output = [&](Token::pointer_type const& tk, std::size_t origin) {
+		postfixTokens.push_back(tk);
+		if (origins)
+			origins->push_back(origin);
+	};
+	auto output_top = [&] {
+		output(operStack.top(), operOrigins.top());
+		pop();
+	};
+
 	try{
-		for (auto tk : infixTokens)
+		for (std::size_t i = 0; i < infixTokens.size(); ++i)
 		{
+			auto const& tk = infixTokens[i];
 			if (is<Operand>(tk))
-				postfixTokens.push_back(tk);
+				output(tk, i);
 			else if (is<Function>(tk))
-				operStack.push(tk);
+				push(tk, i);
 			else if (is<ArgumentSeparator>(tk))
 			{
 				while (!is<LeftParenthesis>(operStack.top()))
 				{
-					postfixTokens.push_back(operStack.top());
-					operStack.pop();
+					output_top();
+				}
+				// if(c,a,b) ==> c JumpIfFalse(b) a Jump(end) b
+				if (!ifCalls.empty() && ifCalls.top().depth == operStack.size())
+				{
+					auto& call = ifCalls.top();
+					if (++call.separators > 2)
+						throw std::runtime_error("Error: if requires three arguments");
+					Jump::pointer_type jump(call.separators == 1 ? new JumpIfFalse : new Jump);
+					if (call.pending)
+						call.pending->set_target(postfixTokens.size() + 1);
+					output(jump, call.origin);
+					call.pending = jump;
 				}
 			}
 			else if (is<LeftParenthesis>(tk))
-				operStack.push(tk);
+			{
+				bool opensIf = !operStack.empty() && is<If>(operStack.top());
+				auto const ifOrigin = opensIf ? operOrigins.top() : 0;
+				push(tk, i);
+				if (opensIf)
+					ifCalls.push(IfCall{ operStack.size(), ifOrigin, 0, nullptr });
+			}
 			else if (is<RightParenthesis>(tk))
 			{
 				while (!is<LeftParenthesis>(operStack.top()))
 				{
-					postfixTokens.push_back(operStack.top());
-					operStack.pop();
+					output_top();
 				}
 				if (operStack.empty())
 					throw "Right parenthesis, has no matching left parenthesis.";
 
-				operStack.pop();
-				if (!operStack.empty() && is<Function>(operStack.top()))
+				bool closesIf = !ifCalls.empty() && ifCalls.top().depth == operStack.size();
+				pop();
+				if (closesIf)
+				{
+					// the jumps replace the If token itself
+					if (ifCalls.top().separators != 2)
+						throw std::runtime_error("Error: if requires three arguments");
+					ifCalls.top().pending->set_target(postfixTokens.size());
+					ifCalls.pop();
+					pop();
+				}
+				else if (!operStack.empty() && is<Function>(operStack.top()))
 				{
-					postfixTokens.push_back(operStack.top());
-					operStack.pop();
+					output_top();
 				}
 			}
 			else if (is<Operator>(tk))
@@ -101,10 +181,9 @@ the program(s) have been supplied.
 						if (operatorTk->precedence() >= operatorSt->precedence())
 							break;
 					}
-					postfixTokens.push_back(operStack.top());
-					operStack.pop();
+					output_top();
 				}//while
-				operStack.push(tk);
+				push(tk, i);
 			}//elseif
 			else
 				throw "Unkown token.";
@@ -113,8 +192,7 @@ the program(s) have been supplied.
 		{
 			if (is<LeftParenthesis>(operStack.top()))
 				throw "Missing right-parenthesis.";
-			postfixTokens.push_back(operStack.top());
-			operStack.pop();
+			output_top();
 		}//while
 	}//try
 	catch (std::string e) {
@@ -122,3 +200,70 @@ the program(s) have been supplied.
 	}
 	return postfixTokens;
 }
+
+
+
+/*! Validate a postfix token list and compute its maximum stack depth.
+	Jumps only go forward, so a single pass sees every path into a token before the token itself.
+	@throws std::runtime_error if an operation lacks operands, operands are left over, or branches disagree.
+*/
+Program::Program(TokenList postfixTokens) : tokens_m(std::move(postfixTokens)) {
+	std::vector<std::optional<std::size_t>> entryDepth(tokens_m.size() + 1);
+	std::size_t depth = 0;
+	bool reachable = true;		// false from an unconditional jump to the next jump target
+
+	auto join = [&](std::size_t target, std::size_t current, std::size_t at) {
+		if (target <= at || target > tokens_m.size())
+			throw std::runtime_error("Error: invalid jump target");
+		if (entryDepth[target] && *entryDepth[target] != current)
+			throw std::runtime_error("Error: branches leave different numbers of operands");
+		entryDepth[target] = current;
+	};
+
+	// merges the jumps to 'at' with the path falling through to it
+	auto arrive = [&](std::size_t at) {
+		if (auto const entry = entryDepth[at]) {
+			if (reachable && depth != *entry)
+				throw std::runtime_error("Error: branches leave different numbers of operands");
+			depth = *entry;
+			reachable = true;
+		}
+	};
+
+	for (std::size_t i = 0; i < tokens_m.size(); ++i) {
+		arrive(i);
+		if (!reachable)
+			continue;
+
+		auto const& tk = tokens_m[i];
+		if (is<Operand>(tk))
+			++depth;
+		else if (is<Jump>(tk)) {
+			if (is<JumpIfFalse>(tk)) {
+				if (depth == 0)
+					throw std::runtime_error("Error: insufficient operands");
+				--depth;
+				join(convert<Jump>(tk)->target(), depth, i);
+			}
+			else {
+				join(convert<Jump>(tk)->target(), depth, i);
+				reachable = false;
+			}
+		}
+		else if (is<Operation>(tk)) {
+			auto nArgs = convert<Operation>(tk)->number_of_args();
+			if (nArgs > depth)
+				throw std::runtime_error("Error: insufficient operands");
+			depth = depth - nArgs + 1;
+		}
+		else
+			throw std::runtime_error("Error: unknown token");
+		stackDepth_m = std::max(stackDepth_m, depth);
+	}
+
+	arrive(tokens_m.size());
+	if (!reachable || depth == 0)
+		throw std::runtime_error("Error: insufficient operands");
+	if (depth > 1)
+		throw std::runtime_error("Error: too many operands");
+}
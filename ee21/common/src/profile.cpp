@@ -0,0 +1,209 @@
+/*!	\file	profile.cpp
+	\brief	Profile class implementation.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/profile.hpp>
+#include <ee/operand.hpp>
+#include <ee/operation.hpp>
+#include <ee/pseudo_operation.hpp>
+#include <algorithm>
+#include <cassert>
+#include <iomanip>
+#include <stack>
+#include <typeinfo>
+#if defined(__GNUG__)
+#include <cstdlib>
+#include <cxxabi.h>
+#include <memory>
+#endif
+using namespace std;
+
+
+
+namespace {
+	/*! The class name of 'token', such as "Power". */
+	[[nodiscard]] string operation_name(Token const& token) {
+		string name = typeid(token).name();
+#if defined(__GNUG__)
+		int status = 0;
+		unique_ptr<char, void (*)(void*)> demangled(abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status), free);
+		if (status == 0)
+			name = demangled.get();
+#endif
+		for (string prefix : { "class ", "struct " })
+			if (name.starts_with(prefix))
+				name.erase(0, prefix.size());
+		return name;
+	}
+
+	/*! A sub-tree of the program: its site, if any, and its first and last infix tokens. */
+	struct Node {
+		size_t	site;
+		size_t	first;
+		size_t	last;
+	};
+
+	/*! An if(c,a,b) whose arguments are not all evaluated yet. */
+	struct OpenIf {
+		size_t			token;			// the JumpIfFalse
+		vector<Node>	arguments;
+		size_t			end = 0;		// the target of the Jump after the second argument
+	};
+}
+
+
+
+Profile::Profile(string const& expression, TokenList const& infixTokens, vector<SourceSpan> const& spans,
+	Program program, vector<size_t> const& origins)
+	: program_m(move(program)) {
+	auto const& tokens = program_m.tokens();
+	assert(origins.size() == tokens.size() && spans.size() == infixTokens.size());
+	siteOf_m.assign(tokens.size(), NO_PARENT);
+
+	// the text of infix tokens [first, last], widened to take in the parentheses they leave open
+	auto source = [&](size_t first, size_t last) {
+		size_t unclosed = 0, unopened = 0;
+		for (auto i = first; i <= last; ++i)
+			if (is<LeftParenthesis>(infixTokens[i]))
+				++unclosed;
+			else if (is<RightParenthesis>(infixTokens[i]))
+				unclosed > 0 ? --unclosed : ++unopened;
+		for (; unopened > 0 && first > 0; --first)
+			if (is<LeftParenthesis>(infixTokens[first - 1]))
+				--unopened;
+			else if (is<RightParenthesis>(infixTokens[first - 1]))
+				++unopened;
+		for (; unclosed > 0 && last + 1 < infixTokens.size(); ++last)
+			if (is<RightParenthesis>(infixTokens[last + 1]))
+				--unclosed;
+			else if (is<LeftParenthesis>(infixTokens[last + 1]))
+				++unclosed;
+		return expression.substr(spans[first].first, spans[last].last - spans[first].first);
+	};
+
+	auto add_site = [&](size_t token, string operation, vector<Node> const& children) {
+		Node node{ sites_m.size(), origins[token], origins[token] };
+		for (auto const& child : children) {
+			node.first = min(node.first, child.first);
+			node.last = max(node.last, child.last);
+			if (child.site != NO_PARENT)
+				sites_m[child.site].parent = node.site;
+		}
+		sites_m.push_back({ move(operation), source(node.first, node.last), NO_PARENT, {} });
+		siteOf_m[token] = node.site;
+		return node;
+	};
+
+	vector<Node> stack;
+	auto pop = [&](size_t n) {
+		assert(n <= stack.size());
+		vector<Node> popped(stack.end() - n, stack.end());
+		stack.resize(stack.size() - n);
+		return popped;
+	};
+
+	std::stack<OpenIf> ifs;
+	for (size_t i = 0; i <= tokens.size(); ++i) {
+		while (!ifs.empty() && ifs.top().arguments.size() == 2 && ifs.top().end == i) {
+			auto call = move(ifs.top());
+			ifs.pop();
+			call.arguments.push_back(pop(1).front());
+			stack.push_back(add_site(call.token, "If", call.arguments));
+		}
+		if (i == tokens.size())
+			break;
+
+		auto const& tk = tokens[i];
+		if (is<Operand>(tk))
+			stack.push_back({ NO_PARENT, origins[i], origins[i] });
+		else if (is<JumpIfFalse>(tk))
+			ifs.push({ i, pop(1) });
+		else if (is<Jump>(tk)) {
+			ifs.top().arguments.push_back(pop(1).front());
+			ifs.top().end = convert<Jump>(tk)->target();
+		}
+		else {
+			auto const nArgs = static_cast<Operation const*>(tk.get())->number_of_args();
+			stack.push_back(add_site(i, operation_name(*tk), pop(nArgs)));
+		}
+	}
+	assert(stack.size() == 1 && ifs.empty());
+}
+
+
+
+[[nodiscard]] map<string, Profile::Counter> Profile::by_operation() const {
+	map<string, Counter> operations;
+	for (auto const& site : sites_m) {
+		auto& counter = operations[site.operation];
+		counter.calls += site.counter.calls;
+		counter.time += site.counter.time;
+	}
+	return operations;
+}
+
+
+
+void Profile::write_folded(ostream& os) const {
+	for (auto const& site : sites_m) {
+		if (site.counter.time.count() <= 0)
+			continue;
+		vector<Site const*> path;
+		for (auto s = &site; ; s = &sites_m[s->parent]) {
+			path.push_back(s);
+			if (s->parent == NO_PARENT)
+				break;
+		}
+		for (auto s = path.rbegin(); s != path.rend(); ++s)
+			os << (s == path.rbegin() ? "" : ";") << (*s)->operation << ": " << (*s)->source;
+		os << ' ' << site.counter.time.count() << '\n';
+	}
+}
+
+
+
+ostream& operator << (ostream& os, Profile const& profile) {
+	auto by_time = [](auto const& l, auto const& r) { return l.second.time > r.second.time; };
+	auto const flags = os.flags();
+
+	auto const counted = profile.by_operation();
+	vector<pair<string, Profile::Counter>> operations(counted.begin(), counted.end());
+	stable_sort(operations.begin(), operations.end(), by_time);
+	os << left << setw(16) << "operation" << right << setw(10) << "calls" << setw(14) << "total ns" << setw(14) << "mean ns" << '\n';
+	for (auto const& [operation, counter] : operations)
+		os << left << setw(16) << operation << right << setw(10) << counter.calls << setw(14) << counter.time.count()
+			<< setw(14) << (counter.calls == 0 ? 0 : counter.time.count() / int64_t(counter.calls)) << '\n';
+
+	vector<pair<Profile::Site const*, Profile::Counter>> sites;
+	for (auto const& site : profile.sites())
+		sites.emplace_back(&site, site.counter);
+	stable_sort(sites.begin(), sites.end(), by_time);
+	os << '\n' << setw(14) << "total ns" << setw(10) << "calls" << "  site\n";
+	for (auto const& [site, counter] : sites)
+		os << setw(14) << counter.time.count() << setw(10) << counter.calls << "  " << site->operation << ": " << site->source << '\n';
+
+	os.flags(flags);
+	return os;
+}
@@ -12,6 +12,9 @@ the subclasses Pi and E.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added real_value_of().
+
 Version 2021.10.26
 	C++ 20 validated
 
@@ -48,12 +51,14 @@ the program(s) have been supplied.
 #include <ee/real.hpp>
 #include <ee/boolean.hpp>
 #include <ee/function.hpp>
+#include <ee/integer.hpp>
 #include <ee/operator.hpp>
 #include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <iomanip>
 #include <sstream>
+#include <stdexcept>
 using namespace std;
 
 
@@ -63,3 +68,13 @@ using namespace std;
 	return oss.str();
 }
 
+
+
+/*! Convert a numeric operand to a real number. */
+[[nodiscard]] Real::value_type real_value_of(Operand::pointer_type const& operand) {
+	if (is<Real>(operand))
+		return value_of<Real>(operand);
+	if (is<Integer>(operand))
+		return Real::value_type(value_of<Integer>(operand));
+	throw std::runtime_error("Error: operand is not a number");
+}
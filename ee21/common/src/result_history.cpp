@@ -0,0 +1,162 @@
+/*!	\file	result_history.cpp
+	\brief	ResultHistory class implementation.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/result_history.hpp>
+#include <ee/serialization.hpp>
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+
+
+/*! The spill files: the serialized results, and the offset of each within the data file.
+	Result 'first' is the first one spilled. */
+struct ResultHistory::Spill {
+	std::filesystem::path	dataPath;
+	std::filesystem::path	indexPath;
+	std::fstream			data;
+	std::fstream			index;
+	index_type				first;
+
+	Spill(std::filesystem::path const& path, index_type firstSpilled) : dataPath(path), indexPath(path), first(firstSpilled) {
+		indexPath += ".index";
+		auto const mode = std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary;
+		data.open(dataPath, mode);
+		index.open(indexPath, mode);
+		if (!data || !index)
+			throw std::runtime_error("Error: cannot create result spill file " + dataPath.string());
+	}
+
+	~Spill() {
+		data.close();
+		index.close();
+		std::error_code ignored;
+		std::filesystem::remove(dataPath, ignored);
+		std::filesystem::remove(indexPath, ignored);
+	}
+
+	void write(Operand::pointer_type const& result) {
+		data.seekp(0, std::ios::end);
+		std::uint64_t const offset = data.tellp();
+		write_operand(data, result);
+		index.seekp(0, std::ios::end);
+		index.write(reinterpret_cast<char const*>(&offset), sizeof(offset));
+		if (!data || !index)
+			throw std::runtime_error("Error: cannot write result spill file " + dataPath.string());
+	}
+
+	[[nodiscard]] Operand::pointer_type read(index_type result) {
+		std::uint64_t offset;
+		index.seekg((result - first) * sizeof(offset));
+		index.read(reinterpret_cast<char*>(&offset), sizeof(offset));
+		data.seekg(offset);
+		if (!index || !data)
+			throw std::runtime_error("Error: cannot read result spill file " + dataPath.string());
+		return read_operand(data);
+	}
+};
+
+
+
+ResultHistory::ResultHistory(std::size_t depth) : ring_m(std::max<std::size_t>(depth, 1)) { }
+
+ResultHistory::ResultHistory(ResultHistory const& other) : ring_m(other.ring_m), count_m(other.count_m), held_m(other.held_m) { }
+
+ResultHistory::ResultHistory(ResultHistory&& other) noexcept = default;
+
+ResultHistory& ResultHistory::operator = (ResultHistory const& other) {
+	if (this != &other) {
+		ring_m = other.ring_m;
+		count_m = other.count_m;
+		held_m = other.held_m;
+		spill_m.reset();
+	}
+	return *this;
+}
+
+ResultHistory& ResultHistory::operator = (ResultHistory&& other) noexcept = default;
+
+ResultHistory::~ResultHistory() = default;
+
+
+
+/*! Results stay in their positions by index, so the ring is rebuilt from the kept ones. */
+void ResultHistory::set_depth(std::size_t depth) {
+	depth = std::max<std::size_t>(depth, 1);
+	auto const kept = std::min(held_m, depth);
+	for (index_type i = count_m - held_m + 1; i <= count_m - kept; ++i)
+		evict(i);
+
+	std::vector<Operand::pointer_type> ring(depth);
+	for (index_type i = count_m - kept + 1; i <= count_m; ++i)
+		ring[(i - 1) % depth] = std::move(ring_m[(i - 1) % ring_m.size()]);
+	ring_m = std::move(ring);
+	held_m = kept;
+}
+
+
+
+void ResultHistory::spill_to(std::filesystem::path const& path) {
+	spill_m.reset();
+	spill_m = std::make_unique<Spill>(path, count_m - held_m + 1);
+}
+
+
+
+/*! When the ring is full the oldest result is evicted first. */
+void ResultHistory::add(Operand::pointer_type const& result) {
+	if (held_m == ring_m.size()) {
+		evict(count_m - held_m + 1);
+		--held_m;
+	}
+	ring_m[count_m % ring_m.size()] = result;
+	++count_m;
+	++held_m;
+}
+
+
+
+[[nodiscard]] Operand::pointer_type ResultHistory::operator [] (index_type index) const {
+	if (index < 1 || index > count_m)
+		throw std::runtime_error("Error: result index out of range");
+	if (count_m - index < held_m)
+		return ring_m[(index - 1) % ring_m.size()];
+	if (spill_m && index >= spill_m->first)
+		return spill_m->read(index);
+	throw std::runtime_error("Error: result has been discarded");
+}
+
+
+
+/*! Spills result 'index', if spilling, and releases its slot of the ring.
+	Results are evicted oldest first, so the spill files stay in index order. */
+void ResultHistory::evict(index_type index) {
+	auto& slot = ring_m[(index - 1) % ring_m.size()];
+	if (spill_m)
+		spill_m->write(slot);
+	slot.reset();
+}
@@ -0,0 +1,398 @@
+/*!	\file	serialization.cpp
+	\brief	Binary operand serialization implementation.
+	\author	Garth Santor
+	\date	2026-10-19
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.19
+	Alpha release.
+	Added the binary program format.
+	Integer byte counts are checked against the input before the magnitude is read.
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/serialization.hpp>
+#include <ee/boolean.hpp>
+#include <ee/function.hpp>
+#include <ee/integer.hpp>
+#include <ee/operator.hpp>
+#include <ee/pseudo_operation.hpp>
+#include <ee/real.hpp>
+#include <ee/variable.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+
+
+namespace {
+	enum class Tag : char { Integer = 'I', Real = 'R', Boolean = 'B', Unset = 'U' };
+
+	template <typename T>
+	void write_raw(std::ostream& os, T const& value) {
+		os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+	}
+
+	/*! Byte source over an input stream. */
+	struct StreamSource {
+		std::istream& is;
+		void read(void* destination, std::size_t size) {
+			if (!is.read(static_cast<char*>(destination), size))
+				throw std::runtime_error("Error: truncated operand");
+		}
+	};
+
+	/*! Byte source over a buffer, such as a memory-mapped file. */
+	class SpanSource {
+		std::span<std::byte const>	bytes_m;
+		std::size_t					position_m = 0;
+	public:
+		explicit SpanSource(std::span<std::byte const> bytes) : bytes_m(bytes) { }
+		void read(void* destination, std::size_t size) {
+			std::memcpy(destination, take(size).data(), size);
+		}
+		[[nodiscard]] std::span<std::byte const> take(std::size_t size) {
+			if (size > bytes_m.size() - position_m)
+				throw std::runtime_error("Error: truncated program");
+			auto const taken = bytes_m.subspan(position_m, size);
+			position_m += size;
+			return taken;
+		}
+		void seek(std::size_t position) {
+			if (position > bytes_m.size())
+				throw std::runtime_error("Error: truncated program");
+			position_m = position;
+		}
+	};
+
+	template <typename T, typename SOURCE>
+	[[nodiscard]] T read_raw(SOURCE& source) {
+		T value;
+		source.read(&value, sizeof(T));
+		return value;
+	}
+
+	/*! Archive for cpp_dec_float::serialize() that writes each member's bytes. */
+	struct BinaryWriter {
+		std::ostream& os;
+		template <typename T> BinaryWriter& operator & (boost::serialization::nvp<T> const& item) { write_raw(os, item.value()); return *this; }
+	};
+
+	/*! Archive for cpp_dec_float::serialize() that reads each member's bytes. */
+	template <typename SOURCE>
+	struct BinaryReader {
+		SOURCE& source;
+		template <typename T> BinaryReader& operator & (boost::serialization::nvp<T> const& item) { source.read(&item.value(), sizeof(T)); return *this; }
+	};
+
+
+
+	/*! Sign byte, 32-bit byte count, then the magnitude bytes, least significant first. */
+	void write_integer(std::ostream& os, Integer::value_type const& integer) {
+		std::vector<std::uint8_t> magnitude;
+		export_bits(integer, std::back_inserter(magnitude), 8, false);
+		write_raw(os, static_cast<std::uint8_t>(integer < 0));
+		write_raw(os, static_cast<std::uint32_t>(magnitude.size()));
+		os.write(reinterpret_cast<char const*>(magnitude.data()), magnitude.size());
+	}
+
+	/*! The byte count is not trusted: a buffer is bounds-checked before the magnitude is read,
+		and a stream is read in blocks, so a corrupt count fails as truncated instead of allocating. */
+	template <typename SOURCE>
+	[[nodiscard]] Integer::value_type read_integer(SOURCE& source) {
+		auto const negative = read_raw<std::uint8_t>(source);
+		auto const size = read_raw<std::uint32_t>(source);
+		Integer::value_type integer;
+		if constexpr (requires { source.take(size); }) {
+			auto const bytes = source.take(size);
+			auto const magnitude = reinterpret_cast<std::uint8_t const*>(bytes.data());
+			import_bits(integer, magnitude, magnitude + bytes.size(), 8, false);
+		}
+		else {
+			constexpr std::size_t BLOCK = 4096;
+			std::vector<std::uint8_t> magnitude;
+			while (magnitude.size() < size) {
+				auto const done = magnitude.size();
+				magnitude.resize(done + std::min<std::size_t>(BLOCK, size - done));
+				source.read(magnitude.data() + done, magnitude.size() - done);
+			}
+			import_bits(integer, magnitude.begin(), magnitude.end(), 8, false);
+		}
+		return negative ? Integer::value_type(-integer) : integer;
+	}
+
+	/*! The members of the cpp_dec_float backend, as laid out in memory. */
+	void write_real(std::ostream& os, Real::value_type real) {
+		BinaryWriter archive{ os };
+		real.backend().serialize(archive, 0);
+	}
+
+	template <typename SOURCE>
+	[[nodiscard]] Real::value_type read_real(SOURCE& source) {
+		Real::value_type real;
+		BinaryReader<SOURCE> archive{ source };
+		real.backend().serialize(archive, 0);
+		return real;
+	}
+}
+
+
+
+/*! An unset variable is written as a tag of its own and read back as a new unset variable. */
+void write_operand(std::ostream& os, Operand::pointer_type const& operand) {
+	auto const value = is<Variable>(operand) ? convert<Variable>(operand)->value() : operand;
+	if (!value)
+		write_raw(os, Tag::Unset);
+	else if (is<Integer>(value)) {
+		write_raw(os, Tag::Integer);
+		write_integer(os, value_of<Integer>(value));
+	}
+	else if (is<Real>(value)) {
+		write_raw(os, Tag::Real);
+		write_real(os, value_of<Real>(value));
+	}
+	else if (is<Boolean>(value)) {
+		write_raw(os, Tag::Boolean);
+		write_raw(os, static_cast<std::uint8_t>(value_of<Boolean>(value)));
+	}
+	else
+		throw std::runtime_error("Error: operand cannot be serialized");
+}
+
+
+
+[[nodiscard]] Operand::pointer_type read_operand(std::istream& is) {
+	StreamSource source{ is };
+	switch (read_raw<Tag>(source)) {
+	case Tag::Integer:
+		return make_operand<Integer>(read_integer(source));
+	case Tag::Real:
+		return make_operand<Real>(read_real(source));
+	case Tag::Boolean:
+		return make_operand<Boolean>(read_raw<std::uint8_t>(source) != 0);
+	case Tag::Unset:
+		return make_operand<Variable>();
+	}
+	throw std::runtime_error("Error: unknown operand tag");
+}
+
+
+
+/*	Program format, version 1, in host byte order:
+
+		ProgramHeader
+		TokenRecord[tokenCount]
+		variable names: variableCount x (uint32 length, characters)
+		literal pool: literalBytes bytes of write_integer()/write_real() values
+
+	A record holds a token code and an argument: the offset of a literal in the pool,
+	the index of a variable name, or the target of a jump.  Operations carry no state,
+	so every record of an operation shares one token. */
+namespace {
+	constexpr char			PROGRAM_MAGIC[4] = { 'E', 'E', 'P', 'F' };
+	constexpr std::uint16_t	PROGRAM_VERSION = 1;
+	constexpr std::uint16_t	BYTE_ORDER_MARK = 0x0102;
+
+	struct ProgramHeader {
+		char			magic[4];
+		std::uint16_t	version;
+		std::uint16_t	byteOrder;
+		std::uint32_t	realDigits;
+		std::uint32_t	tokenCount;
+		std::uint32_t	stackDepth;
+		std::uint32_t	variableCount;
+		std::uint32_t	literalBytes;
+	};
+
+	enum class Code : std::uint8_t { Integer, Real, True, False, Variable, Jump, JumpIfFalse, FirstOperation = 16 };
+
+	struct TokenRecord {
+		std::uint8_t	code;
+		std::uint8_t	reserved[3];
+		std::uint32_t	argument;
+	};
+
+	static_assert(sizeof(ProgramHeader) == 28 && sizeof(TokenRecord) == 8);
+
+	/*! The operation tokens, numbered from Code::FirstOperation.  Append only: the position is the file format. */
+	[[nodiscard]] std::vector<Token::pointer_type> const& operation_tokens() {
+		static std::vector<Token::pointer_type> const tokens = {
+			make<Identity>(), make<Negation>(), make<Not>(), make<Factorial>(),
+			make<Addition>(), make<Subtraction>(), make<Multiplication>(), make<Division>(), make<Modulus>(),
+			make<And>(), make<Nand>(), make<Nor>(), make<Or>(), make<Xor>(), make<Xnor>(),
+			make<Equality>(), make<Inequality>(), make<Greater>(), make<GreaterEqual>(), make<Less>(), make<LessEqual>(),
+			make<Assignment>(), make<Power>(),
+			make<Abs>(), make<Arccos>(), make<Arcsin>(), make<Arctan>(), make<Ceil>(), make<Cos>(), make<Exp>(),
+			make<Floor>(), make<Lb>(), make<Ln>(), make<Log>(), make<Result>(), make<Sin>(), make<Sqrt>(), make<Tan>(),
+			make<Arctan2>(), make<Max>(), make<Min>(), make<Pow>(),
+			make<If>()
+		};
+		return tokens;
+	}
+
+	[[nodiscard]] std::uint8_t operation_code(Token const& token) {
+		static std::unordered_map<std::type_index, std::uint8_t> const codes = [] {
+			std::unordered_map<std::type_index, std::uint8_t> codes;
+			auto const& tokens = operation_tokens();
+			for (std::size_t i = 0; i < tokens.size(); ++i)
+				codes.emplace(typeid(*tokens[i]), static_cast<std::uint8_t>(std::size_t(Code::FirstOperation) + i));
+			return codes;
+		}();
+		auto const code = codes.find(typeid(token));
+		if (code == codes.end())
+			throw std::runtime_error("Error: token cannot be serialized: " + token.str());
+		return code->second;
+	}
+}
+
+
+
+/*! Literals are written to the pool as they are met; each variable name is stored once. */
+void write_program(std::ostream& os, Program const& program, std::function<Token::string_type(std::size_t slot)> const& variable_name) {
+	auto const& tokens = program.tokens();
+	std::vector<TokenRecord> records;
+	records.reserve(tokens.size());
+	std::vector<std::size_t> slots;
+	std::ostringstream pool(std::ios::binary);
+
+	for (auto const& tk : tokens) {
+		TokenRecord record{};
+		auto const at = static_cast<std::uint32_t>(pool.tellp());
+		if (is<Variable>(tk)) {
+			auto const slot = convert<Variable>(tk)->slot();
+			auto const found = std::find(slots.begin(), slots.end(), slot);
+			record.code = std::uint8_t(Code::Variable);
+			record.argument = static_cast<std::uint32_t>(found - slots.begin());
+			if (found == slots.end())
+				slots.push_back(slot);
+		}
+		else if (is<Integer>(tk)) {
+			record = { std::uint8_t(Code::Integer), {}, at };
+			write_integer(pool, value_of<Integer>(tk));
+		}
+		else if (is<Real>(tk)) {
+			record = { std::uint8_t(Code::Real), {}, at };
+			write_real(pool, value_of<Real>(tk));
+		}
+		else if (is<Boolean>(tk))
+			record.code = std::uint8_t(value_of<Boolean>(tk) ? Code::True : Code::False);
+		else if (is<Jump>(tk)) {
+			record.code = std::uint8_t(is<JumpIfFalse>(tk) ? Code::JumpIfFalse : Code::Jump);
+			record.argument = static_cast<std::uint32_t>(convert<Jump>(tk)->target());
+		}
+		else
+			record.code = operation_code(*tk);
+		records.push_back(record);
+	}
+
+	auto const literals = pool.str();
+	ProgramHeader header{ { PROGRAM_MAGIC[0], PROGRAM_MAGIC[1], PROGRAM_MAGIC[2], PROGRAM_MAGIC[3] }, PROGRAM_VERSION, BYTE_ORDER_MARK,
+		std::uint32_t(std::numeric_limits<Real::value_type>::digits10), std::uint32_t(records.size()), std::uint32_t(program.stack_depth()),
+		std::uint32_t(slots.size()), std::uint32_t(literals.size()) };
+	write_raw(os, header);
+	os.write(reinterpret_cast<char const*>(records.data()), records.size() * sizeof(TokenRecord));
+	for (auto slot : slots) {
+		auto const name = variable_name(slot);
+		write_raw(os, static_cast<std::uint32_t>(name.size()));
+		os.write(name.data(), name.size());
+	}
+	os.write(literals.data(), literals.size());
+	if (!os)
+		throw std::runtime_error("Error: cannot write program");
+}
+
+
+
+/*! Operations are shared, literals are copied out of the pool, and variables are
+	bound by name through 'variable'.  The token list is validated as Program
+	construction always does, and must have the stack depth recorded in the header. */
+[[nodiscard]] Program read_program(std::span<std::byte const> bytes, std::function<Token::pointer_type(Token::string_type const& name)> const& variable) {
+	SpanSource source(bytes);
+	auto const header = read_raw<ProgramHeader>(source);
+	if (!std::equal(std::begin(PROGRAM_MAGIC), std::end(PROGRAM_MAGIC), header.magic))
+		throw std::runtime_error("Error: not a compiled program");
+	if (header.version != PROGRAM_VERSION)
+		throw std::runtime_error("Error: unsupported program format version " + std::to_string(header.version));
+	if (header.byteOrder != BYTE_ORDER_MARK)
+		throw std::runtime_error("Error: program was written with a different byte order");
+	if (header.realDigits != std::uint32_t(std::numeric_limits<Real::value_type>::digits10))
+		throw std::runtime_error("Error: program was written with a different Real precision");
+
+	auto const records = source.take(std::size_t(header.tokenCount) * sizeof(TokenRecord));
+	std::vector<Token::pointer_type> variables;
+	variables.reserve(header.variableCount);
+	for (std::uint32_t i = 0; i < header.variableCount; ++i) {
+		auto const name = source.take(read_raw<std::uint32_t>(source));
+		variables.push_back(variable(Token::string_type(reinterpret_cast<char const*>(name.data()), name.size())));
+	}
+	SpanSource pool(source.take(header.literalBytes));
+
+	auto const& operations = operation_tokens();
+	TokenList tokens;
+	for (std::uint32_t i = 0; i < header.tokenCount; ++i) {
+		TokenRecord record;
+		std::memcpy(&record, records.data() + i * sizeof(TokenRecord), sizeof(TokenRecord));
+		switch (Code(record.code)) {
+		case Code::Integer:
+			pool.seek(record.argument);
+			tokens.push_back(make<Integer>(read_integer(pool)));
+			break;
+		case Code::Real:
+			pool.seek(record.argument);
+			tokens.push_back(make<Real>(read_real(pool)));
+			break;
+		case Code::True:
+			tokens.push_back(make<True>());
+			break;
+		case Code::False:
+			tokens.push_back(make<False>());
+			break;
+		case Code::Variable:
+			if (record.argument >= variables.size())
+				throw std::runtime_error("Error: invalid variable in program");
+			tokens.push_back(variables[record.argument]);
+			break;
+		case Code::Jump:
+		case Code::JumpIfFalse: {
+			auto jump = Code(record.code) == Code::Jump ? make<Jump>() : make<JumpIfFalse>();
+			static_cast<Jump*>(jump.get())->set_target(record.argument);
+			tokens.push_back(jump);
+			break;
+		}
+		default: {
+			std::size_t const operation = record.code - std::size_t(Code::FirstOperation);
+			if (record.code < std::uint8_t(Code::FirstOperation) || operation >= operations.size())
+				throw std::runtime_error("Error: invalid token code in program");
+			tokens.push_back(operations[operation]);
+		}
+		}
+	}
+
+	Program program(std::move(tokens));
+	if (program.stack_depth() != header.stackDepth)
+		throw std::runtime_error("Error: corrupt program");
+	return program;
+}
@@ -9,6 +9,15 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added 'if' keyword and add_keyword().
+	_get_number() accumulates short literals into a 64-bit significand instead of building a digit string.
+	_get_number() accepts scientific notation, and 0x/0b prefixed integers.
+	New variables take the next slot of the tokenizer's EvaluationContext.
+	Records the name of each slot.
+	Added tokenize() with source spans.
+	Negative exponents beyond the range of Real underflow to zero.
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -65,6 +74,8 @@ the program(s) have been supplied.
 #include <ee/real.hpp>
 #include <ee/variable.hpp>
 
+#include <array>
+#include <cstdint>
 #include <exception>
 #include <limits>
 #include <sstream>
@@ -73,7 +84,7 @@ the program(s) have been supplied.
 using namespace std;
 
 /** Default constructor loads the keyword dictionary. */
-Tokenizer::Tokenizer() {
+Tokenizer::Tokenizer() : context_m(std::make_shared<EvaluationContext>()) {
 	keywords_m["abs"]     = keywords_m["Abs"]		= keywords_m["ABS"]		= make<Abs>();
 	keywords_m["and"]     = keywords_m["And"]		= keywords_m["AND"]		= make<And>();
 	keywords_m["arccos"]  = keywords_m["Arccos"]	= keywords_m["ARCCOS"]	= make<Arccos>();
@@ -86,6 +97,7 @@ Tokenizer::Tokenizer() {
 	keywords_m["exp"]     = keywords_m["Exp"]		= keywords_m["EXP"]		= make<Exp>();
 	keywords_m["false"]   = keywords_m["False"]	= keywords_m["FALSE"]	= make<False>();
 	keywords_m["floor"]   = keywords_m["Floor"]	= keywords_m["FLOOR"]	= make<Floor>();
+	keywords_m["if"]      = keywords_m["If"]		= keywords_m["IF"]		= make<If>();
 	keywords_m["lb"]      = keywords_m["Lb"]		= keywords_m["LB"]		= make<Lb>();
 	keywords_m["ln"]      = keywords_m["Ln"]		= keywords_m["LN"]		= make<Ln>();
 	keywords_m["log"]     = keywords_m["Log"]		= keywords_m["LOG"]		= make<Log>();
@@ -110,6 +122,22 @@ Tokenizer::Tokenizer() {
 
 
 
+/** Bind a keyword to a token, replacing any existing binding.
+	@param keyword [in] the lower-case keyword.  The capitalized and upper-case spellings are bound as well.
+	@param token [in] the token the keyword stands for.
+	*/
+void Tokenizer::add_keyword(string_type const& keyword, Token::pointer_type const& token) {
+	string_type capitalized(keyword), upper(keyword);
+	if (!capitalized.empty())
+		capitalized[0] = char(toupper(capitalized[0]));
+	for (auto& ch : upper)
+		ch = char(toupper(ch));
+	keywords_m[keyword] = keywords_m[capitalized] = keywords_m[upper] = token;
+}
+
+
+
+
 /** Get an identifier from the expression.
 	Assumes that the currentChar is pointing to a alphabetic.
 	*/
@@ -125,44 +153,176 @@ Token::pointer_type Tokenizer::_get_identifier(Tokenizer::string_type::const_ite
 	if (iter != end(keywords_m))
 		return iter->second;
 
-	// check for variable
-	iter = variables_m.find(ident);
+	return _get_variable(ident);
+}
+
+
+
+/*! Find the variable 'name', or add it in the next free slot of the context. */
+Token::pointer_type Tokenizer::_get_variable(string_type const& name) {
+	auto iter = variables_m.find(name);
 	if (iter != variables_m.end())
 		return iter->second;
 
-	// add a variable
-	Token::pointer_type result = make<Variable>();
-	variables_m[ident] = result;
+	auto const slot = variables_m.size();
+	context_m->reserve_slots(slot + 1);
+	Token::pointer_type result(new Variable(context_m, slot));
+	variables_m[name] = result;
+	variableNames_m.push_back(name);
 	return result;
 }
 
 
 
+std::size_t Tokenizer::slot_of(string_type const& name) {
+	return static_cast<Variable const*>(_get_variable(name).get())->slot();
+}
+
+
+
+
+namespace {
+	using const_iterator = Tokenizer::string_type::const_iterator;
+
+	/** Number of decimal digits that always fit in an unsigned 64-bit accumulator. */
+	constexpr unsigned FAST_PATH_DIGITS = numeric_limits<uint64_t>::digits10;
+
+	/** Powers of ten representable in 64 bits. */
+	constexpr auto POWERS_OF_10 = [] {
+		array<uint64_t, FAST_PATH_DIGITS + 1> powers{ 1 };
+		for (size_t i = 1; i < powers.size(); ++i)
+			powers[i] = powers[i - 1] * 10;
+		return powers;
+	}();
+
+	/** Value of a hexadecimal digit character, or 16 if 'ch' is not one. */
+	constexpr unsigned digit_value(char ch) {
+		if (ch >= '0' && ch <= '9') return unsigned(ch - '0');
+		if (ch >= 'a' && ch <= 'f') return unsigned(ch - 'a' + 10);
+		if (ch >= 'A' && ch <= 'F') return unsigned(ch - 'A' + 10);
+		return 16;
+	}
+
+	/** Accumulates the decimal digits [first, last) in 19-digit chunks. */
+	Integer::value_type decimal_value(const_iterator first, const_iterator last) {
+		Integer::value_type value;
+		uint64_t chunk = 0;
+		unsigned chunkDigits = 0;
+		for (; first != last; ++first) {
+			chunk = chunk * 10 + unsigned(*first - '0');
+			if (++chunkDigits == FAST_PATH_DIGITS) {
+				value = value * POWERS_OF_10[FAST_PATH_DIGITS] + chunk;
+				chunk = 0;
+				chunkDigits = 0;
+			}
+		}
+		return value * POWERS_OF_10[chunkDigits] + chunk;
+	}
+
+	/** Accumulates the power-of-two radix digits at 'currentChar' in 64-bit chunks.
+		@param bitsPerDigit [in] 1 for binary, 4 for hexadecimal. */
+	Integer::value_type radix_value(const_iterator& currentChar, const_iterator last, unsigned bitsPerDigit) {
+		Integer::value_type value;
+		uint64_t chunk = 0;
+		unsigned chunkBits = 0;
+		for (unsigned digit; currentChar != last && (digit = digit_value(*currentChar)) < (1u << bitsPerDigit); ++currentChar) {
+			chunk = (chunk << bitsPerDigit) | digit;
+			if ((chunkBits += bitsPerDigit) == 64) {
+				value = (value << 64) | chunk;
+				chunk = 0;
+				chunkBits = 0;
+			}
+		}
+		return (value << chunkBits) | chunk;
+	}
+}
+
+
 
 /** Get a number token from the expression.
-	@return One of BinaryInteger, Integer, or Real.
+	Accepts decimal integers, reals of the form digits[.[digits]][(e|E)[+|-]digits], and
+	integers with a 0x (hexadecimal) or 0b (binary) prefix.
+	Integers are accumulated directly into the numeric representation in 64-bit chunks.  Reals
+	whose value is a whole number of up to FAST_PATH_DIGITS digits are built from a 64-bit
+	significand; the remaining reals are handed to the multiprecision parser in one step.
+	@return One of Integer or Real.
 	@param currentChar [in,out] an iterator to the current character.  Assumes that the currentChar is pointing to a digit.
 	@param expression [in] the expression being scanned.
+	@note Will throw 'XNumericOverflow' if the exponent exceeds the range of Real; a negative
+		exponent beyond the range underflows to zero.
 */
 Token::pointer_type Tokenizer::_get_number(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression) {
 	assert(isdigit(*currentChar) && "currentChar must pointer to a digit");
+	auto const first = currentChar;
+	auto const last = end(expression);
+
+	// Hexadecimal or binary integer
+	if (*currentChar == '0' && next(currentChar) != last) {
+		char const prefix = *next(currentChar);
+		unsigned const bitsPerDigit = prefix == 'x' || prefix == 'X' ? 4 : prefix == 'b' || prefix == 'B' ? 1 : 0;
+		auto const digit = next(currentChar, 2);
+		if (bitsPerDigit != 0 && digit != last && digit_value(*digit) < (1u << bitsPerDigit)) {
+			currentChar = digit;
+			return make<Integer>(radix_value(currentChar, last, bitsPerDigit));
+		}
+	}
 
 	// Either Integer or Real
-	string digits(1, *currentChar++);
-
-	while (currentChar != end(expression) && isdigit(*currentChar))
-		digits += *currentChar++;
+	uint64_t significand = 0;
+	unsigned nDigits = 0;
+	for (; currentChar != last && isdigit(*currentChar); ++currentChar, ++nDigits)
+		significand = significand * 10 + unsigned(*currentChar - '0');
+	auto const integerEnd = currentChar;
+
+	// fraction
+	int scale = 0;
+	bool const hasPoint = currentChar != last && *currentChar == '.';
+	if (hasPoint)
+		for (++currentChar; currentChar != last && isdigit(*currentChar); ++currentChar, ++nDigits, --scale)
+			significand = significand * 10 + unsigned(*currentChar - '0');
+
+	// exponent - only when followed by [sign] digit, otherwise the 'e' belongs to the next token
+	bool hasExponent = false;
+	if (currentChar != last && (*currentChar == 'e' || *currentChar == 'E')) {
+		auto digit = next(currentChar);
+		bool const negative = digit != last && *digit == '-';
+		if (digit != last && (*digit == '-' || *digit == '+'))
+			++digit;
+		if (digit != last && isdigit(*digit)) {
+			hasExponent = true;
+			long long exponent = 0;
+			bool underflow = false;
+			for (currentChar = digit; currentChar != last && isdigit(*currentChar); ++currentChar) {
+				if (underflow)
+					continue;
+				if ((exponent = exponent * 10 + (*currentChar - '0')) > numeric_limits<Real::value_type>::max_exponent10) {
+					if (!negative)
+						throw XNumericOverflow(expression, first - begin(expression));
+					underflow = true;
+				}
+			}
+			if (underflow)
+				return make<Real>(Real::value_type(0));
+			scale += int(negative ? -exponent : exponent);
+		}
+	}
 
-	if (currentChar == end(expression) || (!isdigit(*currentChar) && *currentChar != '.'))
-		return make<Integer>(Integer::value_type(digits));
+	if (!hasPoint && !hasExponent) {
+		if (nDigits <= FAST_PATH_DIGITS)
+			return make<Integer>(Integer::value_type(significand));
+		return make<Integer>(decimal_value(first, integerEnd));
+	}
 
 	// a real number
-	digits += *currentChar++;
-	while (currentChar != end(expression) && isdigit(*currentChar))
-		digits += *currentChar++;
-
-
-	return make<Real>(Real::value_type(digits));
+	if (nDigits <= FAST_PATH_DIGITS) {
+		for (; scale < 0 && significand % 10 == 0 && significand != 0; ++scale)
+			significand /= 10;
+		if (significand == 0)
+			return make<Real>(Real::value_type(0));
+		if (scale >= 0 && unsigned(scale) <= FAST_PATH_DIGITS && significand <= numeric_limits<uint64_t>::max() / POWERS_OF_10[scale])
+			return make<Real>(Real::value_type(significand * POWERS_OF_10[scale]));
+	}
+	return make<Real>(Real::value_type(string_type(first, currentChar)));
 }
 
 
@@ -174,17 +334,40 @@ Token::pointer_type Tokenizer::_get_number(Tokenizer::string_type::const_iterato
 	@note Will throws 'BadCharacter' if the expression contains an un-tokenizable character.
 	*/
 TokenList Tokenizer::tokenize(string_type const& expression) {
+	return _tokenize(expression, nullptr);
+}
+
+
+
+/** Tokenize the expression, recording where each token came from.
+	@param spans [out] Receives the span of each token, in token order.
+	*/
+TokenList Tokenizer::tokenize(string_type const& expression, std::vector<SourceSpan>& spans) {
+	spans.clear();
+	return _tokenize(expression, &spans);
+}
+
+
+
+/** Tokenize the expression, recording the token spans in 'spans', which starts empty, if it is not null. */
+TokenList Tokenizer::_tokenize(string_type const& expression, std::vector<SourceSpan>* spans) {
 	TokenList tokenizedExpression;
 	auto currentChar = expression.cbegin();
+	std::size_t tokenFirst = 0;
 
 	for(;;)
 	{
+		// each pass reads one token, which ends where the next pass begins
+		if (spans && spans->size() < tokenizedExpression.size())
+			spans->push_back({ tokenFirst, std::size_t(currentChar - begin(expression)) });
+
 		// strip whitespace
 		while (currentChar != end(expression) && isspace(*currentChar))
 			++currentChar;
 
 		// check of end of expression
 		if (currentChar == end(expression)) break;
+		tokenFirst = currentChar - begin(expression);
 
 		// check for a number
 		if (isdigit(*currentChar)) {
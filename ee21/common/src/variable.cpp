@@ -11,6 +11,12 @@ Implementation of the Variable class derived from Operand.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added dereference().
+	set() stamps a version from the shared variable clock.
+	Moved value storage and the version clock to EvaluationContext.
+	str() reads the active context.
+
 Version 2021.10.26
 	C++ 20 validated
 
@@ -38,9 +44,25 @@ the program(s) have been supplied.
 =============================================================*/
 
 #include <ee/variable.hpp>
+#include <stdexcept>
+
+
 
 [[nodiscard]] Token::string_type Variable::str() const {
-	if (!value_m)
+	auto const& value = this->value();
+	if (!value)
 		return Token::string_type("Variable: null");
-	return value_m->str();
+	return value->str();
+}
+
+
+
+/*! Resolve a variable operand to its value. */
+[[nodiscard]] Operand::pointer_type dereference(Operand::pointer_type const& operand) {
+	if (!is<Variable>(operand))
+		return operand;
+	auto const& value = static_cast<Variable const*>(operand.get())->value();
+	if (!value)
+		throw std::runtime_error("Error: variable not initialized");
+	return value;
 }
@@ -8,6 +8,14 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Evaluates each command; named formulas are loaded from a FormulaLibrary.
+	Added the --library and --build-library options.
+	Added the --emit-cpp option.
+	Added the #stats commands.
+	Added the --profile option and #profile command.
+	Added the --no-fold option of --emit-cpp.
+
 Version 2021.11.01
 	C++ 20 validated
 
@@ -44,29 +52,156 @@ the program(s) have been supplied.
 
 #include <gats/ConsoleApp.hpp>
 #include <ee/expression_evaluator.hpp>
+#include <ee/formula_library.hpp>
 #include <ee/function.hpp>
 #include <ee/real.hpp>
+#include <ee/variable.hpp>
 
 #include <algorithm>
+#include <fstream>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <regex>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 using namespace std;
 
 
 
+namespace {
+	/*! Reads 'name: expression' lines, skipping blank lines. */
+	[[nodiscard]] vector<pair<string, string>> read_formulas(string const& path) {
+		ifstream file(path);
+		if (!file)
+			throw runtime_error("Error: cannot read " + path);
+		vector<pair<string, string>> formulas;
+		static regex const line(R"(\s*([A-Za-z_]\w*)\s*:\s*(.+?)\s*)");
+		string text;
+		for (unsigned number = 1; getline(file, text); ++number) {
+			smatch parts;
+			if (regex_match(text, parts, line))
+				formulas.emplace_back(parts[1], parts[2]);
+			else if (text.find_first_not_of(" \t\r") != string::npos)
+				throw runtime_error("Error: " + path + "(" + to_string(number) + "): expected 'name: expression'");
+		}
+		return formulas;
+	}
+
+	void usage() {
+		cerr << "usage: ee [--library <file>]\n"
+			<< "       ee --build-library <file> <formulas>\n"
+			<< "       ee --emit-cpp [--native] [--no-fold] (<formulas> | <name> <expression>)\n"
+			<< "       ee --profile <expression> [<repetitions>]\n"
+			<< "  <formulas> holds one 'name: expression' per line.  Entering the name of\n"
+			<< "  a library formula evaluates the precompiled formula.  --emit-cpp writes\n"
+			<< "  the formulas to standard output as C++ functions using multiprecision,\n"
+			<< "  or with --native 64-bit integer and double, arithmetic.  --no-fold leaves\n"
+			<< "  constant sub-expressions to the C++ code instead of evaluating them.\n"
+			<< "  At the prompt, '#stats on' and '#stats off' start and stop timing the\n"
+			<< "  evaluation stages, and '#stats' shows the measurements.\n"
+			<< "  --profile writes the time of each operation as folded stacks for\n"
+			<< "  flamegraph.pl; '#profile <expression>' shows it at the prompt.\n";
+	}
+
+	/*! Writes the helpers and one C++ function per formula. */
+	void emit_formulas(vector<pair<string, string>> const& formulas, CppNumbers numbers, CppFolding folding) {
+		ExpressionEvaluator evaluator;
+		ostringstream functions;
+		for (auto const& [name, expression] : formulas) {
+			functions << "\n// " << name << ": " << expression << '\n';
+			evaluator.emit_cpp(evaluator.compile(expression), name, numbers, functions, folding);
+		}
+		emit_cpp_prelude(cout, numbers);
+		cout << functions.str();
+	}
+}
+
+
 
 MAKEAPP(ee) {
-	cout << "Expression Evaluator, (c) 1998-2021 Garth Santor\n";
-	for (unsigned count = 0; ; ++count) {
-		cout << "> ";
-		string command;
-		if (!getline(cin, command) || command.empty())
-			break;
-
-		cout << "[" << count << "] = " << 42 << endl;
+	auto const& args = get_args();
+	try {
+		ExpressionEvaluator evaluator;
+		unique_ptr<FormulaLibrary> library;
+		if (args.size() == 4 && args[1] == "--build-library") {
+			auto const formulas = read_formulas(args[3]);
+			FormulaLibrary::write(args[2], evaluator, formulas);
+			cout << formulas.size() << " formulas written to " << args[2] << endl;
+			return EXIT_SUCCESS;
+		}
+		if (args.size() >= 3 && args[1] == "--emit-cpp") {
+			auto numbers = CppNumbers::Multiprecision;
+			auto folding = CppFolding::Constants;
+			size_t first = 2;
+			for (; first < args.size(); ++first)
+				if (args[first] == "--native")
+					numbers = CppNumbers::Native;
+				else if (args[first] == "--no-fold")
+					folding = CppFolding::None;
+				else
+					break;
+			auto const rest = args.size() - first;
+			if (rest == 1) {
+				emit_formulas(read_formulas(args.back()), numbers, folding);
+				return EXIT_SUCCESS;
+			}
+			if (rest == 2) {
+				emit_formulas({ { args[args.size() - 2], args.back() } }, numbers, folding);
+				return EXIT_SUCCESS;
+			}
+			usage();
+			return EXIT_FAILURE;
+		}
+		if ((args.size() == 3 || args.size() == 4) && args[1] == "--profile") {
+			auto const repetitions = args.size() == 4 ? stoul(args[3]) : 1;
+			evaluator.profile(args[2], repetitions).write_folded(cout);
+			return EXIT_SUCCESS;
+		}
+		if (args.size() == 3 && args[1] == "--library")
+			library = make_unique<FormulaLibrary>(args[2]);
+		else if (args.size() != 1) {
+			usage();
+			return EXIT_FAILURE;
+		}
+
+		cout << "Expression Evaluator, (c) 1998-2021 Garth Santor\n";
+		RPNEvaluator rpn;
+		for (;;) {
+			cout << "> ";
+			string command;
+			if (!getline(cin, command) || command.empty())
+				break;
+
+			if (command == "#stats on" || command == "#stats off") {
+				evaluator.enable_stats(command == "#stats on");
+				continue;
+			}
+			if (command == "#stats") {
+				cout << evaluator.stats();
+				continue;
+			}
+
+			try {
+				if (command.starts_with("#profile ")) {
+					cout << evaluator.profile(command.substr(9));
+					continue;
+				}
+				auto result = library && library->contains(command)
+					? rpn.evaluate(library->load(command, evaluator), evaluator.context())
+					: static_pointer_cast<Operand>(evaluator.evaluate(command));
+				cout << "[" << evaluator.context().result_count() << "] = " << dereference(result)->str() << endl;
+			}
+			catch (exception const& e) {
+				cout << e.what() << endl;
+			}
+		}
+	}
+	catch (exception const& e) {
+		cerr << e.what() << endl;
+		return EXIT_FAILURE;
 	}
 
 	return EXIT_SUCCESS;
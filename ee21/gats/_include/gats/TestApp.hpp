@@ -2,7 +2,7 @@
 /*!	\file	TestApp.hpp
 	\brief	TestApp framework declarations.
 	\author	Garth Santor
-	\date	2021-10-29
+	\date	2026-10-19
 	\copyright	Garth Santor, Trinh Han
 
 =============================================================
@@ -11,19 +11,35 @@ TestApp frame declarations.
 	TestApp::TestCase class declaration.
 	TestApp::TestCase::check_equal template implemenation.
 	TestApp::TestCase::check_close_epsilon template implemenation.
+	TestApp::BenchCase class declaration.
 	GATS_TEST_CASE()
 	GATS_TEST_CASE_WEIGHTED()
+	GATS_TEST_CASE_SERIAL()
+	GATS_BENCH_CASE()
 	GATS_CHECK()
 	GATS_CHECK_MESSAGE()
 	GATS_CHECK_EQUAL()
 	GATS_CHECK_WITHIN()
 	GATS_CHECK_THROW()
 	GATS_FAIL()
+	gats::do_not_optimize()
 
 =============================================================
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added:
+		TestApp::BenchCase
+		GATS_BENCH_CASE()
+		gats::do_not_optimize()
+		Bench baseline file and --update-baseline
+		GATS_TEST_CASE_SERIAL()
+		--threads
+	Changed:
+		Test cases run on a pool of threads; the current case is per thread.
+		Case output is buffered and written in case order to the console and log file.
+
 Version 2021.10.29
 	Added:
 		TestApp::current_case()
@@ -62,6 +78,8 @@ the program(s) have been supplied.
 
 #include <gats/ConsoleApp.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <fstream>
 #include <iostream>
@@ -69,6 +87,7 @@ the program(s) have been supplied.
 #include <sstream>
 #include <vector>
 #include <filesystem>
+#include <map>
 #include <type_traits>
 
 
@@ -91,13 +110,17 @@ namespace gats {
 			
 			TestCase is the base type of classes generated by GATS_TEST_CASE().
 			It provides services to the test case that can be accessed via the
-			GATS_CHECK macros. */
+			GATS_CHECK macros.  Cases run concurrently unless 'serial', so a case
+			that changes process-wide state must be serial. */
 		class TestCase {
 		// ATTRIBUTES
 			string_type		name_m;				
 			std::uintmax_t	nChecked_m = 0;
 			std::uintmax_t	nPassed_m = 0;
 			double			weight_m = 1.0;			// weighted score of this case.
+			bool			serial_m = false;		// run alone, after the concurrent cases.
+			ostringstream_type	display_m;			// console (and log) output, written after the run.
+			ostringstream_type	log_m;				// log output, written after the run.
 
 		// OPERATIONS
 		public:
@@ -106,7 +129,7 @@ namespace gats {
 			void operator = (TestCase const&) = delete;
 
 			// Constructors
-			TestCase(string_type const& name, double weight);
+			TestCase(string_type const& name, double weight, bool serial = false);
 			TestCase(string_type const& name) : TestCase(name, 1) {}
 
 			// Application Interface
@@ -124,8 +147,8 @@ namespace gats {
 			void check_close_within(const LHS& lhs, const RHS& rhs, const VALUE& minimum, const char_type* lhsStr, const char_type* rhsStr, const char_type* minimumStr, const char* const file, int line);
 
 			// Parent Services
-			inline ostream_type& display() { return TestApp::display(); }
-			inline ostream_type& log() { return TestApp::logFile_m; }
+			inline ostream_type& display() { return display_m; }
+			inline ostream_type& log() { return log_m; }
 
 			constexpr auto operator <=> (TestCase const& rhs) const { return name_m <=> rhs.name_m; }
 			constexpr bool operator == (TestCase const& rhs) const { return name_m == rhs.name_m; }
@@ -134,12 +157,60 @@ namespace gats {
 			friend class TestApp;
 		};
 
+		/*!	\brief class TestApp::BenchCase
+
+			BenchCase is the base type of classes generated by GATS_BENCH_CASE().
+			Its execute() runs body() repeatedly for the case's time budget, and is
+			one check: that the median time per run has not regressed past the
+			time stored for the case in the baseline file.  Bench cases are serial,
+			so no other case runs while they are timed. */
+		class BenchCase : public TestCase {
+		public:
+			using duration = std::chrono::duration<double, std::nano>;
+
+			/*! Robust statistics of the time per run of the body. */
+			struct Statistics {
+				duration	median{};
+				duration	p99{};
+				duration	mad{};			// median absolute deviation from the median.
+			};
+
+		// ATTRIBUTES
+		private:
+			std::chrono::milliseconds	budget_m;
+
+		// OPERATIONS
+		public:
+			BenchCase(string_type const& name, std::chrono::milliseconds budget) : TestCase(name, 1, true), budget_m(budget) {}
+
+			/*! The timed operation.  It is run many times, so it should make no checks. */
+			virtual void body() = 0;
+
+			void execute() override;
+
+			/*! The statistics of 'samples', each a time per run in nanoseconds. */
+			[[nodiscard]] static Statistics statistics(std::vector<double> samples);
+
+			/*! True if 'current' has regressed from 'baseline' (see BENCH_TOLERANCE). */
+			[[nodiscard]] static bool regressed(Statistics const& current, Statistics const& baseline);
+		};
+
+		/*! A bench case regresses when its median exceeds the baseline median by more than BENCH_TOLERANCE
+			of it, and by more than BENCH_MADS median absolute deviations (the run's or the baseline's, whichever is larger). */
+		static constexpr double BENCH_TOLERANCE = 0.10;
+		static constexpr double BENCH_MADS = 3.0;
+
 	// ATTRIBUTES
 	private:
 		using Container = std::vector<TestCase*>;
+		using BenchRecords = std::map<string_type, BenchCase::Statistics>;
 		static std::unique_ptr<Container> casesPtr_sm;
 		static ofstream_type logFile_m;
-		static TestCase* currentCasePtr_sm;
+		static thread_local TestCase* currentCasePtr_sm;
+		static unsigned threads_sm;
+		static BenchRecords benchBaseline_sm;		// from the baseline file.
+		static BenchRecords benchMeasured_sm;		// by this run.
+		static bool updateBaseline_sm;
 
 	// OPERATIONS
 		static ostream_type& display() { return std::cout; }
@@ -149,11 +220,23 @@ namespace gats {
 		void setup() override;
 		int execute() override;
 
+		static void run_case(TestCase& testCase);
+		void write_bench_baseline();
+
 	public:
 		static TestCase* current_case(const char* file, int line);
 	};
 
 
+	/*!	Keeps the compiler from discarding the computation of 'value' in a bench case body. */
+	template <typename T>
+	inline void do_not_optimize(T const& value) {
+		[[maybe_unused]] static T const* volatile sink;
+		sink = &value;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+	}
+
+
 	/*!	\brief Check for value equality.
 	
 		Check for value equality, reporting if different.
@@ -225,6 +308,36 @@ namespace gats {
 	void TestCase_ ## name :: execute()
 
 
+/*!	Creates a test case with the identifier 'name' that runs alone
+
+	\param 'name' is the test cases identifier.
+
+	For cases that change process-wide state; they run one at a time, after the other cases.
+*/
+#define GATS_TEST_CASE_SERIAL(name) \
+	static class TestCase_ ## name : public gats::TestApp::TestCase {\
+	public: TestCase_ ## name() : TestCase(#name, 1, true) { }\
+	public: virtual void execute() override;\
+	} TestCase_ ## name ## _g;\
+	void TestCase_ ## name :: execute()
+
+
+/*!	Creates a bench case with the identifier 'name'
+
+	\param 'name' is the bench case's identifier.
+	\param 'budget' is the time, in milliseconds, spent running the body.
+
+	The body is timed over repeated runs and the median time per run compared with the baseline
+	in "gats-bench-baseline.txt"; run the test application with --update-baseline to replace it.
+*/
+#define GATS_BENCH_CASE(name,budget) \
+	static class BenchCase_ ## name : public gats::TestApp::BenchCase {\
+	public: BenchCase_ ## name() : BenchCase(#name, std::chrono::milliseconds(budget)) { }\
+	public: virtual void body() override;\
+	} BenchCase_ ## name ## _g;\
+	void BenchCase_ ## name :: body()
+
+
 /*!	Performs a check point for the specified condition.
 
 	\param 'cond' is condition that must pass.
@@ -1,7 +1,7 @@
 /*!	\file	TestApp.cpp
 	\brief	TestApp framework implementations.
 	\author	Garth Santor
-	\date	2021-10-29
+	\date	2026-10-19
 	\copyright	Garth Santor, Trinh Han
 
 =============================================================
@@ -10,6 +10,7 @@ TestApp framework implementations.
 	TestApp::TestCase class declaration.
 	TestApp::TestCase::check_equal template implemenation.
 	TestApp::TestCase::check_close_epsilon template implemenation.
+	TestApp::BenchCase class implementation.
 	GATS_TEST_CASE()
 	GATS_TEST_CASE_WEIGHTED()
 	GATS_CHECK()
@@ -22,6 +23,15 @@ TestApp framework implementations.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.19
+	Added:
+		TestApp::BenchCase
+		Bench baseline file and --update-baseline
+		--threads
+	Changed:
+		Test cases run on a pool of threads; the current case is per thread.
+		Case output is buffered and written in case order to the console and log file.
+
 Version 2021.10.29
 	Added:
 		TestApp::current_case()
@@ -57,6 +67,9 @@ the program(s) have been supplied.
 
 
 #include <gats/TestApp.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -64,6 +77,7 @@ the program(s) have been supplied.
 #include <functional>
 #include <filesystem>
 #include <string>
+#include <thread>
 
 
 namespace gats {
@@ -72,7 +86,7 @@ namespace gats {
 // ----------------------------------------------------------------------------
 
 	/*!	TestCase constructor registers the test case with the TestApp */
-	TestApp::TestCase::TestCase(string_type const& name, double weight) : name_m(name), weight_m(weight) {
+	TestApp::TestCase::TestCase(string_type const& name, double weight, bool serial) : name_m(name), weight_m(weight), serial_m(serial) {
 		TestApp::cases().push_back(this);
 	}
 
@@ -115,6 +129,93 @@ namespace gats {
 
 
 
+// ----------------------------------------------------------------------------
+// TestApp::BenchCase
+// ----------------------------------------------------------------------------
+
+	/*!	Runs the body for the case's budget and checks its median time per run against the baseline. */
+	void TestApp::BenchCase::execute() {
+		using clock = std::chrono::steady_clock;
+		constexpr auto MIN_SAMPLE_TIME = std::chrono::microseconds(100);
+		constexpr std::size_t MIN_SAMPLES = 5;
+
+		// Warm up, then find how many runs make a sample well above the clock's resolution.
+		body();
+		std::uintmax_t batch = 1;
+		for (;;) {
+			auto const start = clock::now();
+			for (std::uintmax_t i = 0; i < batch; ++i)
+				body();
+			if (clock::now() - start >= MIN_SAMPLE_TIME)
+				break;
+			batch *= 2;
+		}
+
+		// Sample until the budget is spent.
+		std::vector<double> samples;
+		auto const stop = clock::now() + budget_m;
+		while (samples.size() < MIN_SAMPLES || clock::now() < stop) {
+			auto const start = clock::now();
+			for (std::uintmax_t i = 0; i < batch; ++i)
+				body();
+			samples.push_back(duration(clock::now() - start).count() / batch);
+		}
+
+		auto const nSamples = samples.size();
+		auto const measured = statistics(std::move(samples));
+		benchMeasured_sm[name_m] = measured;
+
+		ostringstream_type oss;
+		oss << std::setprecision(1) << std::fixed << "\"" << name_m << "\": median " << measured.median.count() << " ns, p99 "
+			<< measured.p99.count() << " ns, MAD " << measured.mad.count() << " ns (" << nSamples << " samples of " << batch << ")";
+
+		add_check();
+		auto const baseline = benchBaseline_sm.find(name_m);
+		if (baseline == benchBaseline_sm.end() || updateBaseline_sm) {
+			oss << ", recorded as baseline\n";
+			add_passed();
+		} else if (regressed(measured, baseline->second)) {
+			oss << "\nerror in \"" << name_m << "\": median regressed from baseline " << baseline->second.median.count() << " ns\n";
+		} else {
+			oss << ", baseline " << baseline->second.median.count() << " ns\n";
+			add_passed();
+		}
+		display() << oss.str();
+	}
+
+
+
+	/*!	Computes the median, 99th percentile (nearest rank) and median absolute deviation of the samples. */
+	TestApp::BenchCase::Statistics TestApp::BenchCase::statistics(std::vector<double> samples) {
+		if (samples.empty())
+			return {};
+
+		auto median = [](std::vector<double>& values) {
+			std::sort(values.begin(), values.end());
+			auto const n = values.size();
+			return n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+		};
+
+		Statistics result;
+		result.median = duration(median(samples));
+		auto const nearest = static_cast<std::size_t>(std::ceil(0.99 * samples.size()));
+		result.p99 = duration(samples[nearest - 1]);
+		for (auto& sample : samples)
+			sample = std::abs(sample - result.median.count());
+		result.mad = duration(median(samples));
+		return result;
+	}
+
+
+
+	/*!	A regression must be both a relative slow-down and well outside the noise of the measurements. */
+	bool TestApp::BenchCase::regressed(Statistics const& current, Statistics const& baseline) {
+		auto const slower = current.median - baseline.median;
+		return slower > baseline.median * BENCH_TOLERANCE && slower > std::max(current.mad, baseline.mad) * BENCH_MADS;
+	}
+
+
+
 // ----------------------------------------------------------------------------
 // TestApp
 // ----------------------------------------------------------------------------
@@ -122,7 +223,14 @@ namespace gats {
 	//! Classifier instances for TestApp
 	std::unique_ptr<TestApp::Container> TestApp::casesPtr_sm;
 	std::ofstream TestApp::logFile_m;
-	TestApp::TestCase* TestApp::currentCasePtr_sm = nullptr;
+	thread_local TestApp::TestCase* TestApp::currentCasePtr_sm = nullptr;
+	unsigned TestApp::threads_sm = std::max(std::thread::hardware_concurrency(), 1u);
+	TestApp::BenchRecords TestApp::benchBaseline_sm;
+	TestApp::BenchRecords TestApp::benchMeasured_sm;
+	bool TestApp::updateBaseline_sm = false;
+
+	//! The bench baseline file, beside the log file.
+	std::filesystem::path const benchBaselinePath_g = "gats-bench-baseline.txt";
 
 
 
@@ -140,7 +248,7 @@ namespace gats {
 
 
 
-	/*!	Get a reference to the cases container. */
+	/*!	Get the case running on this thread. */
 	TestApp::TestCase* TestApp::current_case(const char* file, int line) {
 		using namespace std;
 		if (currentCasePtr_sm == nullptr) {
@@ -150,7 +258,8 @@ namespace gats {
 	}
 
 
-	/*!	'setup' overrides the application method to register a logfile for storing test results. */
+	/*!	'setup' overrides the application method to register a logfile for storing test results,
+		and to load the bench baseline. */
 	void TestApp::setup() {
 		using namespace std;
 		std::filesystem::path filename = "gats-test-log-file.txt";
@@ -158,6 +267,69 @@ namespace gats {
 		if (!logFile_m) {
 			throw std::runtime_error("Could not open: "s + filename.string());
 		}
+
+		auto const& args = get_args();
+		for (std::size_t i = 1; i < args.size(); ++i)
+			if (args[i] == "--update-baseline")
+				updateBaseline_sm = true;
+			else if (args[i] == "--threads" && i + 1 < args.size())
+				threads_sm = std::max(static_cast<unsigned>(std::stoul(args[++i])), 1u);
+
+		// Each baseline line is: name median_ns p99_ns mad_ns
+		std::ifstream baseline(benchBaselinePath_g);
+		for (string_type line; std::getline(baseline, line);) {
+			if (line.empty() || line[0] == '#')
+				continue;
+			std::istringstream iss(line);
+			string_type name;
+			double median, p99, mad;
+			if (!(iss >> name >> median >> p99 >> mad))
+				throw std::runtime_error("Malformed line in "s + benchBaselinePath_g.string() + ": " + line);
+			benchBaseline_sm[name] = { BenchCase::duration(median), BenchCase::duration(p99), BenchCase::duration(mad) };
+		}
+	}
+
+
+
+	/*!	Runs 'testCase' as this thread's current case.  An exception escaping the case is a failed check. */
+	void TestApp::run_case(TestCase& testCase) {
+		currentCasePtr_sm = &testCase;
+		try {
+			testCase.execute();
+		}
+		catch (std::exception& e) {
+			testCase.add_check();
+			testCase.display() << "error in \"" << testCase.name_m << "\": unhandled exception: " << e.what() << "\n";
+		}
+		catch (...) {
+			testCase.add_check();
+			testCase.display() << "error in \"" << testCase.name_m << "\": unhandled exception\n";
+		}
+		currentCasePtr_sm = nullptr;
+	}
+
+
+
+	/*!	Adds the cases measured for the first time to the baseline file, or all measured cases
+		with --update-baseline.  Cases not run keep their baseline. */
+	void TestApp::write_bench_baseline() {
+		using namespace std;
+		bool changed = false;
+		for (auto const& [name, measured] : benchMeasured_sm)
+			if (updateBaseline_sm || !benchBaseline_sm.contains(name)) {
+				benchBaseline_sm[name] = measured;
+				changed = true;
+			}
+		if (!changed)
+			return;
+
+		std::ofstream file(benchBaselinePath_g);
+		if (!file) {
+			throw std::runtime_error("Could not open: "s + benchBaselinePath_g.string());
+		}
+		file << "# name\tmedian_ns\tp99_ns\tmad_ns\n" << std::setprecision(1) << std::fixed;
+		for (auto const& [name, baseline] : benchBaseline_sm)
+			file << name << '\t' << baseline.median.count() << '\t' << baseline.p99.count() << '\t' << baseline.mad.count() << '\n';
 	}
 
 
@@ -183,13 +355,34 @@ namespace gats {
 		// sort the cases
 		std::sort(cases().begin(), cases().end(), [](TestApp::TestCase* pLHS, TestApp::TestCase* pRHS)->bool { return *pLHS < *pRHS; });
 
-		// Run the cases
+		// Run the cases: the concurrent ones on a pool of threads taking them in order, then the serial ones.
+		Container concurrent, serial;
+		for (auto& testCase : cases())
+			(testCase->serial_m || threads_sm == 1 ? serial : concurrent).push_back(testCase);
+
+		std::atomic<std::size_t> next{ 0 };
+		auto worker = [&] {
+			for (std::size_t i; (i = next++) < concurrent.size();)
+				run_case(*concurrent[i]);
+		};
+		std::vector<std::thread> pool;
+		for (std::size_t i = 1; i < std::min<std::size_t>(threads_sm, concurrent.size()); ++i)
+			pool.emplace_back(worker);
+		worker();
+		for (auto& thread : pool)
+			thread.join();
+
+		for (auto& testCase : serial)
+			run_case(*testCase);
+		write_bench_baseline();
+
+		// Output of the cases, in case order
 		for (auto& testCase : cases()) {
+			auto const output = testCase->display_m.str();
 			std::wcout << bright(yellow);
-			currentCasePtr_sm = testCase;
-			testCase->execute();
-			currentCasePtr_sm = nullptr;
+			std::cout << output;
 			std::wcout << white;
+			logFile_m << output << testCase->log_m.str();
 		}
 
 